@@ -81,8 +81,12 @@ public:
  * no such assignment exists.
  *
  * This example parses a dimacs CNF file in which
- * the constraints are specified. For each line of
- * the file a clause propagator is posted.
+ * the constraints are specified. Either a clause
+ * propagator is posted for each line of the file or
+ * all clauses are posted as a single clause database
+ * (model option clause-db). Note that with a clause
+ * database all variables have the same AFC, so the
+ * AFC-based branching degenerates to a static order.
  *
  * Format of dimacs CNF files:
  *
@@ -113,10 +117,15 @@ private:
   /// The Boolean variables
   BoolVarArray x;
 public:
+  /// Model variants
+  enum {
+    MODEL_CLAUSE,   ///< Post a clause propagator per clause
+    MODEL_CLAUSE_DB ///< Post all clauses as a clause database
+  };
   /// The actual problem
   Sat(const SatOptions& opt)
     : Script(opt) {
-    parseDIMACS(opt.filename.c_str());
+    parseDIMACS(opt.filename.c_str(), opt.model());
     branch(*this, x, BOOL_VAR_AFC_MAX(), BOOL_VAL_MIN());
   }
 
@@ -137,8 +146,8 @@ public:
     os << "solution:\n" << x << std::endl;
   }
 
-  /// Post constraints according to DIMACS file \a f
-  void parseDIMACS(const char* f) {
+  /// Post constraints according to DIMACS file \a f and model \a m
+  void parseDIMACS(const char* f, int m) {
     int variables = 0;
     int clauses = 0;
     std::ifstream dimacs(f);
@@ -150,6 +159,8 @@ public:
               << std::endl;
     std::string line;
     int c = 0;
+    // Literals of all clauses for the clause database
+    std::vector<int> lits;
     while (dimacs.good()) {
       std::getline(dimacs,line);
       // Comments (ignore them)
@@ -181,6 +192,7 @@ public:
         c++;
         std::vector<int> pos;
         std::vector<int> neg;
+        std::vector<int> lit;
         int i = 0;
         while (line[i] != 0) {
           if (line[i] == ' ') {
@@ -198,6 +210,7 @@ public:
             i++;
           }
           if (value != 0) {
+            lit.push_back(positive ? value : -value);
             if (positive)
               pos.push_back(value-1);
             else
@@ -206,6 +219,12 @@ public:
           }
         }
 
+        if (m == MODEL_CLAUSE_DB) {
+          lits.insert(lits.end(),lit.begin(),lit.end());
+          lits.push_back(0);
+          continue;
+        }
+
         // Create positive BoolVarArgs
         BoolVarArgs positives(pos.size());
         for (int i=pos.size(); i--;)
@@ -225,6 +244,8 @@ public:
       }
     }
     dimacs.close();
+    if (m == MODEL_CLAUSE_DB)
+      clause_db(*this, x, IntArgs(lits));
     if (clauses != c) {
       std::cerr << "error: number of specified clauses seems to be wrong."
                 << std::endl;
@@ -240,6 +261,11 @@ public:
 int main(int argc, char* argv[]) {
 
   SatOptions opt("SAT");
+  opt.model(Sat::MODEL_CLAUSE);
+  opt.model(Sat::MODEL_CLAUSE, "clause",
+            "post a clause propagator per clause");
+  opt.model(Sat::MODEL_CLAUSE_DB, "clause-db",
+            "post all clauses as a single clause database");
   opt.parse(argc,argv);
 
   // Check whether all arguments are successfully parsed
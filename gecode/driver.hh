@@ -382,8 +382,10 @@ namespace Gecode {
     Driver::StringOption      _search;        ///< Search options
     Driver::UnsignedIntOption _solutions;     ///< How many solutions
     Driver::DoubleOption      _threads;       ///< How many threads to use
+    Driver::BoolOption        _affinity;      ///< Whether to bind threads to processing units
     Driver::UnsignedIntOption _c_d;           ///< Copy recomputation distance
     Driver::UnsignedIntOption _a_d;           ///< Adaptive recomputation distance
+    Driver::BoolOption        _c_d_adaptive;  ///< Whether to adapt copy recomputation distance
     Driver::UnsignedIntOption _d_l;           ///< Discrepancy limit for LDS
     Driver::UnsignedIntOption _node;          ///< Cutoff for number of nodes
     Driver::UnsignedIntOption _fail;          ///< Cutoff for number of failures
@@ -491,6 +493,11 @@ namespace Gecode {
     /// Return number of parallel threads
     double threads(void) const;
 
+    /// Set default thread affinity behavior
+    void affinity(bool b);
+    /// Return whether threads are bound to processing units
+    bool affinity(void) const;
+
     /// Set default copy recomputation distance
     void c_d(unsigned int d);
     /// Return copy recomputation distance
@@ -501,6 +508,11 @@ namespace Gecode {
     /// Return adaptive recomputation distance
     unsigned int a_d(void) const;
 
+    /// Set default whether to adapt copy recomputation distance
+    void c_d_adaptive(bool b);
+    /// Return whether copy recomputation distance is adapted
+    bool c_d_adaptive(void) const;
+
     /// Set default discrepancy limit for LDS
     void d_l(unsigned int d);
     /// Return discrepancy limit for LDS
@@ -588,8 +588,12 @@ namespace Gecode {
       _solutions("solutions","number of solutions (0 = all)",1),
       _threads("threads","number of threads (0 = #processing units)",
                Search::Config::threads),
+      _affinity("affinity","whether to bind threads to processing units",
+                Search::Config::affinity),
       _c_d("c-d","recomputation commit distance",Search::Config::c_d),
       _a_d("a-d","recomputation adaptation distance",Search::Config::a_d),
+      _c_d_adaptive("c-d-adaptive","whether to adapt recomputation commit distance",
+                    Search::Config::c_d_adaptive),
       _d_l("d-l","discrepancy limit for LDS",Search::Config::d_l),
       _node("node","node cutoff (0 = none, solution mode)"),
       _fail("fail","failure cutoff (0 = none, solution mode)"),
@@ -643,8 +647,8 @@ namespace Gecode {
 
     add(_model); add(_symmetry); add(_propagation); add(_ipl);
     add(_branching); add(_decay); add(_seed); add(_step);
-    add(_search); add(_solutions); add(_threads); add(_c_d); add(_a_d);
-    add(_d_l);
+    add(_search); add(_solutions); add(_threads); add(_affinity);
+    add(_c_d); add(_a_d); add(_c_d_adaptive); add(_d_l);
     add(_node); add(_fail); add(_time); add(_interrupt);
     add(_assets); add(_slice);
     add(_restart); add(_r_base); add(_r_scale);
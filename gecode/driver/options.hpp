@@ -297,6 +297,15 @@ namespace Gecode {
     return _threads.value();
   }
 
+  inline void
+  Options::affinity(bool b) {
+    _affinity.value(b);
+  }
+  inline bool
+  Options::affinity(void) const {
+    return _affinity.value();
+  }
+
   inline void
   Options::c_d(unsigned int d) {
     _c_d.value(d);
@@ -315,6 +324,15 @@ namespace Gecode {
     return _a_d.value();
   }
 
+  inline void
+  Options::c_d_adaptive(bool b) {
+    _c_d_adaptive.value(b);
+  }
+  inline bool
+  Options::c_d_adaptive(void) const {
+    return _c_d_adaptive.value();
+  }
+
   inline void
   Options::d_l(unsigned int d) {
     _d_l.value(d);
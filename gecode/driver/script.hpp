@@ -370,8 +370,10 @@ namespace Gecode { namespace Driver {
           unsigned int n_p = PropagatorGroup::all.size(*s);
           unsigned int n_b = BrancherGroup::all.size(*s);
           so.threads = o.threads();
+          so.affinity = o.affinity();
           so.c_d     = o.c_d();
           so.a_d     = o.a_d();
+          so.c_d_adaptive = o.c_d_adaptive();
           so.d_l     = o.d_l();
           so.assets  = o.assets();
           so.slice   = o.slice();
@@ -443,7 +445,10 @@ namespace Gecode { namespace Driver {
                   << "\tfailures:     " << stat.fail << endl
                   << "\trestarts:     " << stat.restart << endl
                   << "\tno-goods:     " << stat.nogood << endl
-                  << "\tpeak depth:   " << stat.depth << endl
+                  << "\tpeak depth:   " << stat.depth << endl;
+            if (o.c_d_adaptive())
+              l_out << "\tcommit dist.: " << stat.c_d << endl;
+            l_out
 #ifdef GECODE_PEAKHEAP
                   << "\tpeak memory:  "
                   << static_cast<int>((heap.peak()+1023) / 1024) << " KB"
@@ -468,10 +473,12 @@ namespace Gecode { namespace Driver {
 
           so.clone   = false;
           so.threads = o.threads();
+          so.affinity = o.affinity();
           so.assets  = o.assets();
           so.slice   = o.slice();
           so.c_d     = o.c_d();
           so.a_d     = o.a_d();
+          so.c_d_adaptive = o.c_d_adaptive();
           so.d_l     = o.d_l();
           so.stop    = CombinedStop::create(o.node(),o.fail(), o.time(),
                                             o.interrupt());
@@ -503,7 +510,10 @@ namespace Gecode { namespace Driver {
                   << "\tfailures:     " << stat.fail << endl
                   << "\trestarts:     " << stat.restart << endl
                   << "\tno-goods:     " << stat.nogood << endl
-                  << "\tpeak depth:   " << stat.depth << endl
+                  << "\tpeak depth:   " << stat.depth << endl;
+            if (o.c_d_adaptive())
+              l_out << "\tcommit dist.: " << stat.c_d << endl;
+            l_out
 #ifdef GECODE_PEAKHEAP
                   << "\tpeak memory:  "
                   << static_cast<int>((heap.peak()+1023) / 1024) << " KB"
@@ -528,10 +538,12 @@ namespace Gecode { namespace Driver {
               Search::Options sok;
               sok.clone   = false;
               sok.threads = o.threads();
+              sok.affinity = o.affinity();
               sok.assets  = o.assets();
               sok.slice   = o.slice();
               sok.c_d     = o.c_d();
               sok.a_d     = o.a_d();
+              sok.c_d_adaptive = o.c_d_adaptive();
               sok.d_l     = o.d_l();
               sok.stop    = CombinedStop::create(o.node(),o.fail(), o.time(),
                                                  false);
@@ -230,10 +230,12 @@ namespace Gecode { namespace FlatZinc {
       Gecode::Driver::IntOption         _solutions; ///< How many solutions
       Gecode::Driver::BoolOption        _allSolutions; ///< Return all solutions
       Gecode::Driver::DoubleOption      _threads;   ///< How many threads to use
+      Gecode::Driver::BoolOption        _affinity;  ///< Whether to bind threads to processing units
       Gecode::Driver::BoolOption        _free; ///< Use free search
       Gecode::Driver::DoubleOption      _decay;       ///< Decay option
       Gecode::Driver::UnsignedIntOption _c_d;       ///< Copy recomputation distance
       Gecode::Driver::UnsignedIntOption _a_d;       ///< Adaptive recomputation distance
+      Gecode::Driver::BoolOption        _c_d_adaptive; ///< Whether to adapt copy recomputation distance
       Gecode::Driver::UnsignedIntOption _node;      ///< Cutoff for number of nodes
       Gecode::Driver::UnsignedIntOption _fail;      ///< Cutoff for number of failures
       Gecode::Driver::UnsignedIntOption _time;      ///< Cutoff for time
@@ -246,6 +248,8 @@ namespace Gecode { namespace FlatZinc {
       Gecode::Driver::UnsignedIntOption _nogoods_limit; ///< Depth limit for extracting no-goods
       Gecode::Driver::BoolOption        _interrupt; ///< Whether to catch SIGINT
       Gecode::Driver::DoubleOption      _step;        ///< Step option
+      Gecode::Driver::BoolOption        _lns_adaptive; ///< Whether to adapt LNS neighborhoods
+      Gecode::Driver::BoolOption        _presolve;  ///< Whether to presolve constraints
       //@}
 
       /// \name Execution options
@@ -271,10 +275,15 @@ namespace Gecode { namespace FlatZinc {
       _allSolutions("a", "return all solutions (equal to -n 0)"),
       _threads("p","number of threads (0 = #processing units)",
                Gecode::Search::Config::threads),
+      _affinity("affinity","whether to bind threads to processing units",
+                Gecode::Search::Config::affinity),
       _free("f", "free search, no need to follow search-specification"),
       _decay("decay","decay factor",0.99),
       _c_d("c-d","recomputation commit distance",Gecode::Search::Config::c_d),
       _a_d("a-d","recomputation adaption distance",Gecode::Search::Config::a_d),
+      _c_d_adaptive("c-d-adaptive",
+                    "whether to adapt recomputation commit distance",
+                    Gecode::Search::Config::c_d_adaptive),
       _node("node","node cutoff (0 = none, solution mode)"),
       _fail("fail","failure cutoff (0 = none, solution mode)"),
       _time("time","time (in ms) cutoff (0 = none, solution mode)"),
@@ -289,6 +298,10 @@ namespace Gecode { namespace FlatZinc {
       _interrupt("interrupt","whether to catch Ctrl-C (true) or not (false)",
                  true),
       _step("step","step distance for float optimization",0.0),
+      _lns_adaptive("lns-adaptive",
+                    "whether to adapt the neighborhood size for LNS",false),
+      _presolve("presolve","whether to presolve constraints before posting",
+                false),
       _mode("mode","how to execute script",Gecode::SM_SOLUTION),
       _stat("s","emit statistics"),
       _output("o","file to send output to")
@@ -311,13 +324,16 @@ namespace Gecode { namespace FlatZinc {
       _restart.add(RM_LUBY,"luby");
       _restart.add(RM_GEOMETRIC,"geometric");
 
-      add(_solutions); add(_threads); add(_c_d); add(_a_d);
+      add(_solutions); add(_threads); add(_affinity); add(_c_d); add(_a_d);
+      add(_c_d_adaptive);
       add(_allSolutions);
       add(_free);
       add(_decay);
       add(_node); add(_fail); add(_time); add(_time_limit); add(_interrupt);
       add(_seed);
       add(_step);
+      add(_lns_adaptive);
+      add(_presolve);
       add(_restart); add(_r_base); add(_r_scale);
       add(_nogoods); add(_nogoods_limit);
       add(_mode); add(_stat);
@@ -351,14 +367,18 @@ namespace Gecode { namespace FlatZinc {
     int solutions(void) const { return _solutions.value(); }
     bool allSolutions(void) const { return _allSolutions.value(); }
     double threads(void) const { return _threads.value(); }
+    bool affinity(void) const { return _affinity.value(); }
     bool free(void) const { return _free.value(); }
     unsigned int c_d(void) const { return _c_d.value(); }
     unsigned int a_d(void) const { return _a_d.value(); }
+    bool c_d_adaptive(void) const { return _c_d_adaptive.value(); }
     unsigned int node(void) const { return _node.value(); }
     unsigned int fail(void) const { return _fail.value(); }
     unsigned int time(void) const { return _time.value(); }
     int seed(void) const { return _seed.value(); }
     double step(void) const { return _step.value(); }
+    bool lns_adaptive(void) const { return _lns_adaptive.value(); }
+    bool presolve(void) const { return _presolve.value(); }
     const char* output(void) const { return _output.value(); }
 
     Gecode::ScriptMode mode(void) const {
@@ -458,6 +478,9 @@ namespace Gecode { namespace FlatZinc {
     /// Initial solution to start the LNS (or NULL for no LNS)
     IntSharedArray _lnsInitialSolution;
 
+    /// Adapted percentage of variables to keep in LNS (empty if not adaptive)
+    IntSharedArray _lnsKeep;
+
     /// Random number generator
     Rnd _random;
 
@@ -541,6 +564,20 @@ namespace Gecode { namespace FlatZinc {
     /// Create new float variable from specification
     void newFloatVar(FloatVarSpec* vs);
 
+    /// Set whether constraints are presolved before posting
+    void presolve(bool b);
+    /**
+     * \brief Presolve the constraints \a dc and \a ces before posting
+     *
+     * Only has an effect if presolving has been enabled. Duplicate
+     * constraints (taking variable aliases into account) are removed,
+     * and all \c bool_clause constraints in \a ces are replaced by a
+     * single clause database (see clause_db). Equalities between
+     * variables are already turned into aliases by the parser.
+     *
+     */
+    void presolveConstraints(std::vector<ConExpr*>& dc,
+                             std::vector<ConExpr*>& ces);
     /// Post a constraint specified by \a ce
     void postConstraints(std::vector<ConExpr*>& ces);
 
@@ -47,6 +47,7 @@
 #include <sstream>
 #include <limits>
 #include <unordered_set>
+#include <unordered_map>
 
 
 namespace std {
@@ -766,9 +767,25 @@ namespace Gecode { namespace FlatZinc {
     typedef std::unordered_set<DFA> DFASet;
     /// Hash table of DFAs
     DFASet dfaSet;
+
+    /// Whether to presolve constraints
+    bool presolve;
+    /// Number of duplicate constraints removed by presolving
+    unsigned long int n_dup;
+    /// Number of clauses aggregated into a clause database by presolving
+    unsigned long int n_clause;
+
+    /// Time (in milliseconds) spent presolving
+    double t_presolve;
+    /// Time (in milliseconds) spent posting constraints
+    double t_post;
+    /// Time (in milliseconds) spent creating branchers
+    double t_branch;
     
     /// Initialize
-    FlatZincSpaceInitData(void) {}
+    FlatZincSpaceInitData(void)
+      : presolve(false), n_dup(0), n_clause(0),
+        t_presolve(0.0), t_post(0.0), t_branch(0.0) {}
   };
 
   FlatZincSpace::FlatZincSpace(FlatZincSpace& f)
@@ -784,6 +801,7 @@ namespace Gecode { namespace FlatZinc {
       _method = f._method;
       _lns = f._lns;
       _lnsInitialSolution = f._lnsInitialSolution;
+      _lnsKeep = f._lnsKeep;
       branchInfo = f.branchInfo;
       iv.update(*this, f.iv);
       iv_lns.update(*this, f.iv_lns);
@@ -847,6 +865,7 @@ namespace Gecode { namespace FlatZinc {
   :  _initData(new FlatZincSpaceInitData),
     intVarCount(-1), boolVarCount(-1), floatVarCount(-1), setVarCount(-1),
     _optVar(-1), _optVarIsInt(true), _lns(0), _lnsInitialSolution(0),
+    _lnsKeep(0),
     _random(random),
     _solveAnnotations(NULL), needAuxVars(true) {
     branchInfo.init();
@@ -992,6 +1011,189 @@ namespace Gecode { namespace FlatZinc {
   }
 #endif
 
+  void
+  FlatZincSpace::presolve(bool b) {
+    if (_initData)
+      _initData->presolve = b;
+  }
+
+  namespace {
+
+    /**
+     * \brief Return for each variable in \a x the smallest index of a variable
+     *
+     * Variables that have been aliased by the parser share the same
+     * variable implementation and hence the same smallest index.
+     */
+    template<class VarArray>
+    std::vector<int> baseVars(const VarArray& x) {
+      std::vector<int> b(static_cast<size_t>(x.size()));
+      std::unordered_map<void*,int> first;
+      for (int i=0; i<x.size(); i++)
+        b[i] = first.insert(std::make_pair(static_cast<void*>(x[i].varimp()),
+                                           i)).first->second;
+      return b;
+    }
+
+    /**
+     * \brief Write a canonical key for \a n to \a os
+     *
+     * Integer and Boolean variables are replaced by their base variables
+     * \a ib and \a bb. Returns false if \a n contains a node for
+     * which no key can be computed.
+     */
+    bool conKey(AST::Node* n,
+                const std::vector<int>& ib, const std::vector<int>& bb,
+                std::ostream& os) {
+      if (n == NULL) {
+        os << "_";
+      } else if (AST::BoolLit* b = dynamic_cast<AST::BoolLit*>(n)) {
+        os << "b" << b->b;
+      } else if (AST::IntLit* i = dynamic_cast<AST::IntLit*>(n)) {
+        os << "i" << i->i;
+      } else if (AST::FloatLit* f = dynamic_cast<AST::FloatLit*>(n)) {
+        os << "f" << std::hexfloat << f->d << std::defaultfloat;
+      } else if (AST::SetLit* sl = dynamic_cast<AST::SetLit*>(n)) {
+        if (sl->interval) {
+          os << "s" << sl->min << ".." << sl->max;
+        } else {
+          os << "s{";
+          for (unsigned int i=0; i<sl->s.size(); i++)
+            os << sl->s[i] << ",";
+          os << "}";
+        }
+      } else if (AST::IntVar* x = dynamic_cast<AST::IntVar*>(n)) {
+        os << "xi" << ib[x->i];
+      } else if (AST::BoolVar* x = dynamic_cast<AST::BoolVar*>(n)) {
+        os << "xb" << bb[x->i];
+      } else if (AST::FloatVar* x = dynamic_cast<AST::FloatVar*>(n)) {
+        os << "xf" << x->i;
+      } else if (AST::SetVar* x = dynamic_cast<AST::SetVar*>(n)) {
+        os << "xs" << x->i;
+      } else if (AST::Array* a = dynamic_cast<AST::Array*>(n)) {
+        os << "[";
+        for (unsigned int i=0; i<a->a.size(); i++) {
+          if (!conKey(a->a[i],ib,bb,os))
+            return false;
+          os << ",";
+        }
+        os << "]";
+      } else if (AST::Call* c = dynamic_cast<AST::Call*>(n)) {
+        os << c->id << "(";
+        if (!conKey(c->args,ib,bb,os))
+          return false;
+        os << ")";
+      } else if (AST::Atom* at = dynamic_cast<AST::Atom*>(n)) {
+        os << at->id;
+      } else if (AST::String* str = dynamic_cast<AST::String*>(n)) {
+        os << "\"" << str->s << "\"";
+      } else {
+        return false;
+      }
+      return true;
+    }
+
+    /// Remove duplicate constraints from \a ces
+    unsigned long int
+    removeDuplicates(std::vector<ConExpr*>& ces,
+                     const std::vector<int>& ib, const std::vector<int>& bb) {
+      std::unordered_set<std::string> seen;
+      unsigned long int n = 0;
+      unsigned int j = 0;
+      for (unsigned int i=0; i<ces.size(); i++) {
+        std::ostringstream key;
+        key << ces[i]->id;
+        if (conKey(ces[i]->args,ib,bb,key) &&
+            conKey(ces[i]->ann,ib,bb,key) &&
+            !seen.insert(key.str()).second) {
+          delete ces[i]; n++;
+        } else {
+          ces[j++] = ces[i];
+        }
+      }
+      ces.resize(j);
+      return n;
+    }
+
+  }
+
+  void
+  FlatZincSpace::presolveConstraints(std::vector<ConExpr*>& dc,
+                                     std::vector<ConExpr*>& ces) {
+    if ((_initData == NULL) || !_initData->presolve || failed())
+      return;
+    Support::Timer t;
+    t.start();
+
+    // Parser aliases share variables, use the same key for them
+    std::vector<int> ib(baseVars(iv));
+    std::vector<int> bb(baseVars(bv));
+
+    _initData->n_dup += removeDuplicates(dc,ib,bb);
+    _initData->n_dup += removeDuplicates(ces,ib,bb);
+
+    // Aggregate clauses over Boolean variables and literals
+    std::vector<int> pos(static_cast<size_t>(bv.size()),-1);
+    BoolVarArgs x;
+    IntArgs c;
+    std::vector<ConExpr*> cl;
+    {
+      unsigned int j = 0;
+      for (unsigned int i=0; i<ces.size(); i++) {
+        ConExpr* ce = ces[i];
+        bool agg = (ce->id == "bool_clause") && (ce->size() == 2) &&
+          (*ce)[0]->isArray() && (*ce)[1]->isArray();
+        for (int k=0; agg && (k<2); k++) {
+          std::vector<AST::Node*>& a = (*ce)[k]->getArray()->a;
+          for (unsigned int l=0; agg && (l<a.size()); l++)
+            agg = a[l]->isBoolVar() || a[l]->isBool();
+        }
+        if (agg)
+          cl.push_back(ce);
+        else
+          ces[j++] = ce;
+      }
+      if (cl.size() < 2) {
+        // Not worth a clause database
+        for (unsigned int i=0; i<cl.size(); i++)
+          ces[j++] = cl[i];
+        cl.clear();
+      }
+      ces.resize(j);
+    }
+    for (unsigned int i=0; i<cl.size(); i++) {
+      IntArgs l;
+      bool sat = false;
+      for (int k=0; !sat && (k<2); k++) {
+        std::vector<AST::Node*>& a = (*cl[i])[k]->getArray()->a;
+        for (unsigned int m=0; !sat && (m<a.size()); m++) {
+          if (a[m]->isBool()) {
+            // A true positive or false negative literal satisfies the clause
+            sat = (a[m]->getBool() == (k == 0));
+          } else {
+            int r = bb[a[m]->getBoolVar()];
+            if (pos[r] < 0) {
+              pos[r] = x.size(); x << bv[r];
+            }
+            l << ((k == 0) ? (pos[r]+1) : -(pos[r]+1));
+          }
+        }
+      }
+      if (!sat) {
+        if (l.size() == 0)
+          // All literals are false
+          fail();
+        c << l << 0;
+      }
+      delete cl[i];
+    }
+    if (!cl.empty()) {
+      _initData->n_clause += cl.size();
+      clause_db(*this, x, c);
+    }
+    _initData->t_presolve += t.stop();
+  }
+
   namespace {
     struct ConExprOrder {
       bool operator() (ConExpr* ce0, ConExpr* ce1) {
@@ -1002,6 +1204,8 @@ namespace Gecode { namespace FlatZinc {
 
   void
   FlatZincSpace::postConstraints(std::vector<ConExpr*>& ces) {
+    Support::Timer t;
+    t.start();
     ConExprOrder ceo;
     std::sort(ces.begin(), ces.end(), ceo);
 
@@ -1017,6 +1221,8 @@ namespace Gecode { namespace FlatZinc {
       delete ces[i];
       ces[i] = NULL;
     }
+    if (_initData)
+      _initData->t_post += t.stop();
   }
 
   void flattenAnnotations(AST::Array* ann, std::vector<AST::Node*>& out) {
@@ -1037,6 +1243,8 @@ namespace Gecode { namespace FlatZinc {
   FlatZincSpace::createBranchers(Printer&p, AST::Node* ann, FlatZincOptions& opt,
                                  bool ignoreUnknown,
                                  std::ostream& err) {
+    Support::Timer t_branch;
+    t_branch.start();
     int seed = opt.seed();
     double decay = opt.decay();
     Rnd rnd(static_cast<unsigned int>(seed));
@@ -1121,6 +1329,10 @@ namespace Gecode { namespace FlatZinc {
             args = call->getArgs(3);
           }
           _lns = args->a[1]->getInt();
+          if (opt.lns_adaptive()) {
+            _lnsKeep = IntSharedArray(1);
+            _lnsKeep[0] = static_cast<int>(_lns);
+          }
           AST::Array *vars = args->a[0]->getArray();
           int k=vars->a.size();
           for (int i=vars->a.size(); i--;)
@@ -1591,6 +1803,8 @@ namespace Gecode { namespace FlatZinc {
       }
     }
 
+    if (_initData)
+      _initData->t_branch += t_branch.stop();
   }
 
   AST::Array*
@@ -1835,11 +2049,13 @@ namespace Gecode { namespace FlatZinc {
     if (status(sstat) != SS_FAILED) {
       n_p = PropagatorGroup::all.size(*this);
     }
+    double rootTime = t_solve.stop() / 1000.0;
     Search::Options o;
     o.stop = Driver::CombinedStop::create(opt.node(), opt.fail(), opt.time(),
                                           true);
     o.c_d = opt.c_d();
     o.a_d = opt.a_d();
+    o.c_d_adaptive = opt.c_d_adaptive();
 
 #ifdef GECODE_HAS_CPPROFILER
 
@@ -1858,6 +2074,7 @@ namespace Gecode { namespace FlatZinc {
     step = opt.step();
 #endif
     o.threads = opt.threads();
+    o.affinity = opt.affinity();
     o.nogoods_limit = opt.nogoods() ? opt.nogoods_limit() : 0;
     o.cutoff  = new Search::CutoffAppend(new Search::CutoffConstant(0), 1, Driver::createCutoff(opt));
     if (opt.interrupt())
@@ -1908,6 +2125,22 @@ namespace Gecode { namespace FlatZinc {
             << std::endl;      
         out << "%%%mzn-stat: solveTime=" << solveTime
             << std::endl;
+        if (_initData != NULL) {
+          // Break down the initialization time
+          double presolveTime = _initData->t_presolve / 1000.0;
+          double postTime = _initData->t_post / 1000.0;
+          double branchTime = _initData->t_branch / 1000.0;
+          out << "%%%mzn-stat: parseTime="
+              << (initTime - presolveTime - postTime - branchTime)
+              << std::endl;
+          if (_initData->presolve)
+            out << "%%%mzn-stat: presolveTime=" << presolveTime
+                << std::endl;
+          out << "%%%mzn-stat: postTime=" << postTime << std::endl
+              << "%%%mzn-stat: branchTime=" << branchTime << std::endl;
+        }
+        out << "%%%mzn-stat: rootTime=" << rootTime
+            << std::endl;
         out << "%%%mzn-stat: solutions="
             << std::abs(noOfSolutions - findSol) << std::endl
             << "%%%mzn-stat: variables="
@@ -1917,8 +2150,15 @@ namespace Gecode { namespace FlatZinc {
             << "%%%mzn-stat: nodes=" << stat.node << std::endl
             << "%%%mzn-stat: failures=" << stat.fail << std::endl
             << "%%%mzn-stat: restarts=" << stat.restart << std::endl
-            << "%%%mzn-stat: peakDepth=" << stat.depth << std::endl
-            << "%%%mzn-stat-end" << std::endl
+            << "%%%mzn-stat: peakDepth=" << stat.depth << std::endl;
+        if ((_initData != NULL) && _initData->presolve)
+          out << "%%%mzn-stat: presolveDuplicates="
+              << _initData->n_dup << std::endl
+              << "%%%mzn-stat: presolveClauses="
+              << _initData->n_clause << std::endl;
+        if (_lnsKeep.size() > 0)
+          out << "%%%mzn-stat: lnsKeep=" << _lnsKeep[0] << std::endl;
+        out << "%%%mzn-stat-end" << std::endl
             << std::endl;
       }
     }
@@ -2000,10 +2240,30 @@ namespace Gecode { namespace FlatZinc {
 
   bool
   FlatZincSpace::slave(const MetaInfo& mi) {
+    if ((mi.type() == MetaInfo::PORTFOLIO) && (_lnsKeep.size() > 0)) {
+      // Each asset adapts its own neighborhood size
+      int k = _lnsKeep[0];
+      _lnsKeep = IntSharedArray(1);
+      _lnsKeep[0] = k;
+      return true;
+    }
+    unsigned int lns = _lns;
+    if ((mi.type() == MetaInfo::RESTART) && (mi.restart() != 0) &&
+        (_lnsKeep.size() > 0)) {
+      if (mi.solution() == 0) {
+        if (mi.exhausted())
+          // The neighborhood contains no solution: relax more variables
+          _lnsKeep[0] = std::max(_lnsKeep[0]-2,1);
+        else
+          // The cutoff stopped the search: relax fewer variables
+          _lnsKeep[0] = std::min(_lnsKeep[0]+2,99);
+      }
+      lns = static_cast<unsigned int>(_lnsKeep[0]);
+    }
     if ((mi.type() == MetaInfo::RESTART) && (mi.restart() != 0) &&
         (_lns > 0) && (mi.last()==NULL) && (_lnsInitialSolution.size()>0)) {
       for (unsigned int i=iv_lns.size(); i--;) {
-        if (_random(99) <= _lns) {
+        if (_random(99) <= lns) {
           rel(*this, iv_lns[i], IRT_EQ, _lnsInitialSolution[i]);
         }
       }
@@ -2013,7 +2273,7 @@ namespace Gecode { namespace FlatZinc {
       const FlatZincSpace& last =
         static_cast<const FlatZincSpace&>(*mi.last());
       for (unsigned int i=iv_lns.size(); i--;) {
-        if (_random(99) <= _lns) {
+        if (_random(99) <= lns) {
           rel(*this, iv_lns[i], IRT_EQ, last.iv_lns[i]);
         }
       }
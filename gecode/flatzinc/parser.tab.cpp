@@ -346,6 +346,7 @@ void initfg(ParserState* pp) {
     pp->floatvars[i].second = NULL;
   }
   if (!pp->hadError) {
+    pp->fg->presolveConstraints(pp->domainConstraints, pp->constraints);
     pp->fg->postConstraints(pp->domainConstraints);
     pp->fg->postConstraints(pp->constraints);
   }
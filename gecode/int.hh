@@ -1394,6 +1394,23 @@ namespace Gecode {
   GECODE_INT_EXPORT void
   clause(Home home, BoolOpType o, const BoolVarArgs& x, const BoolVarArgs& y,
          int n, IntPropLevel ipl=IPL_DEF);
+  /** \brief Post propagator for the conjunction of clauses \a c over \a x
+   *
+   * The clauses are given in DIMACS notation: a literal \f$i>0\f$
+   * refers to \f$x_{i-1}\f$, a literal \f$-i\f$ to \f$\neg x_{i-1}\f$,
+   * and each clause is terminated by 0. All clauses are propagated by
+   * a single propagator with two watched literals per clause, where
+   * the clauses themselves are shared by all clones of a space. For
+   * large numbers of clauses this is considerably more efficient than
+   * posting each clause with clause().
+   *
+   * Throws an exception of type Int::OutOfLimits, if a literal in \a c
+   * does not refer to a variable in \a x.
+   * \ingroup TaskModelIntRelBool
+   */
+  GECODE_INT_EXPORT void
+  clause_db(Home home, const BoolVarArgs& x, const IntArgs& c,
+            IntPropLevel ipl=IPL_DEF);
   /** \brief Post propagator for if-then-else constraint
    *
    * Posts propagator for \f$ z = b ? x : y \f$
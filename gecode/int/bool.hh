@@ -570,6 +570,117 @@ namespace Gecode { namespace Int { namespace Bool {
   };
 
 
+  /**
+   * \brief Boolean clause database propagator
+   *
+   * Performs unit propagation on a conjunction of clauses with two
+   * watched literals per clause. The literal \f$2i\f$ refers to
+   * \f$x_i\f$ and the literal \f$2i+1\f$ to \f$\neg x_i\f$. The literals
+   * of all clauses are stored in a single arena that is shared by all
+   * clones, only the watches are copied during cloning.
+   *
+   * Requires \code #include <gecode/int/bool.hh> \endcode
+   * \ingroup FuncIntProp
+   */
+  class ClauseDB : public Propagator {
+  protected:
+    /// %Clauses shared by all clones
+    class Clauses : public SharedHandle {
+    protected:
+      /// The clause arena
+      class ClauseArena : public SharedHandle::Object {
+      public:
+        /// Number of clauses
+        int n;
+        /// Start of clauses in \a l (clause \a i ends at \a s[i+1])
+        int* s;
+        /// The literals of all clauses
+        int* l;
+        /// Allocate arena for \a n clauses with \a m literals
+        ClauseArena(int n, int m);
+        /// Delete arena
+        virtual ~ClauseArena(void);
+      };
+    public:
+      /// Initialize as empty
+      Clauses(void);
+      /// Copy \a n clauses with start \a s and literals \a l
+      Clauses(int n, const int* s, const int* l);
+      /// Return number of clauses
+      int clauses(void) const;
+      /// Return start of clauses
+      const int* start(void) const;
+      /// Return literals
+      const int* lits(void) const;
+    };
+    /// %Advisors for views (with index of view)
+    class Idx : public Advisor {
+    public:
+      /// Index of view
+      int i;
+      /// Create index advisor
+      Idx(Space& home, Propagator& p, Council<Idx>& c, int i);
+      /// Clone index advisor \a a
+      Idx(Space& home, Idx& a);
+    };
+    /// The views
+    ViewArray<BoolView> x;
+    /// The clauses
+    Clauses c;
+    /// The advisor council
+    Council<Idx> a;
+    /// First watch for each literal (-1 if none)
+    int* h;
+    /// Position in the clause arena for each watch (two per clause)
+    int* w;
+    /// Next watch for each watch (-1 if none)
+    int* nw;
+    /// Indices of views assigned but not yet propagated
+    int* q;
+    /// Number of entries in \a q
+    int n_q;
+    /// Number of assigned views (including the ones in \a q)
+    int n_a;
+    /// Whether literal \a l is true
+    bool istrue(int l) const;
+    /// Whether literal \a l is false
+    bool isfalse(int l) const;
+    /// Constructor for posting
+    ClauseDB(Home home, ViewArray<BoolView>& x, const Clauses& c);
+    /// Constructor for cloning \a p
+    ClauseDB(Space& home, ClauseDB& p);
+  public:
+    /// Copy propagator during cloning
+    GECODE_INT_EXPORT
+    virtual Actor* copy(Space& home);
+    /// Give advice to propagator
+    GECODE_INT_EXPORT
+    virtual ExecStatus advise(Space& home, Advisor& a, const Delta& d);
+    /// Cost function (defined as low linear in the unpropagated views)
+    GECODE_INT_EXPORT
+    virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
+    /// Schedule function
+    GECODE_INT_EXPORT
+    virtual void reschedule(Space& home);
+    /// Perform propagation
+    GECODE_INT_EXPORT
+    virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
+    /**
+     * \brief Post propagator for clauses \a c over \a x
+     *
+     * The clauses are given in DIMACS notation: the literal \f$i>0\f$
+     * refers to \f$x_{i-1}\f$, the literal \f$-i\f$ to \f$\neg x_{i-1}\f$,
+     * and each clause is terminated by 0.
+     */
+    GECODE_INT_EXPORT
+    static ExecStatus post(Home home, ViewArray<BoolView>& x,
+                           const IntArgs& c);
+    /// Delete propagator and return its size
+    GECODE_INT_EXPORT
+    virtual size_t dispose(Space& home);
+  };
+
+
   /**
    * \brief If-then-else propagator base-class
    *
@@ -658,6 +769,7 @@ namespace Gecode { namespace Int { namespace Bool {
 #include <gecode/int/bool/or.hpp>
 #include <gecode/int/bool/eqv.hpp>
 #include <gecode/int/bool/clause.hpp>
+#include <gecode/int/bool/clause-db.hpp>
 #include <gecode/int/bool/ite.hpp>
 
 #endif
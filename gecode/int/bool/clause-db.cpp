@@ -0,0 +1,264 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Copyright:
+ *     Gecode contributors, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/int/bool.hh>
+
+namespace Gecode { namespace Int { namespace Bool {
+
+  /*
+   * Shared clauses
+   *
+   */
+  ClauseDB::Clauses::ClauseArena::~ClauseArena(void) {
+    heap.free<int>(l,s[n]);
+    heap.free<int>(s,n+1);
+  }
+
+
+  /*
+   * Clause database propagator
+   *
+   */
+  ClauseDB::ClauseDB(Home home, ViewArray<BoolView>& x0, const Clauses& c0)
+    : Propagator(home), x(x0), c(c0), a(home), n_q(0), n_a(0) {
+    int n = c.clauses();
+    const int* s = c.start();
+    const int* l = c.lits();
+    h = static_cast<Space&>(home).alloc<int>(2*x.size());
+    for (int i=2*x.size(); i--; )
+      h[i] = -1;
+    w = static_cast<Space&>(home).alloc<int>(2*n);
+    nw = static_cast<Space&>(home).alloc<int>(2*n);
+    // Watch the first two literals of each clause
+    for (int i=0; i<n; i++)
+      for (int j=0; j<2; j++) {
+        int k = 2*i+j;
+        w[k] = s[i]+j;
+        nw[k] = h[l[w[k]]]; h[l[w[k]]] = k;
+      }
+    q = static_cast<Space&>(home).alloc<int>(x.size());
+    for (int i=0; i<x.size(); i++)
+      x[i].subscribe(home,*new (home) Idx(home,*this,a,i));
+    home.notice(*this,AP_DISPOSE);
+  }
+
+  ClauseDB::ClauseDB(Space& home, ClauseDB& p)
+    : Propagator(home,p), c(p.c), n_q(0), n_a(p.n_a) {
+    assert(p.n_q == 0);
+    x.update(home,p.x);
+    a.update(home,p.a);
+    int n = c.clauses();
+    h = Heap::copy(home.alloc<int>(2*x.size()),p.h,2*x.size());
+    w = Heap::copy(home.alloc<int>(2*n),p.w,2*n);
+    nw = Heap::copy(home.alloc<int>(2*n),p.nw,2*n);
+    // Only views that are not yet assigned can be entered into q
+    q = static_cast<Space&>(home).alloc<int>(x.size()-n_a);
+  }
+
+  Actor*
+  ClauseDB::copy(Space& home) {
+    return new (home) ClauseDB(home,*this);
+  }
+
+  PropCost
+  ClauseDB::cost(const Space&, const ModEventDelta&) const {
+    return PropCost::linear(PropCost::LO,n_q);
+  }
+
+  void
+  ClauseDB::reschedule(Space& home) {
+    if (n_q > 0)
+      BoolView::schedule(home,*this,ME_BOOL_VAL);
+  }
+
+  ExecStatus
+  ClauseDB::advise(Space& home, Advisor& _a, const Delta&) {
+    Idx& i = static_cast<Idx&>(_a);
+    q[n_q++] = i.i; n_a++;
+    // The view is assigned, so the advisor is not needed any longer
+    return home.ES_NOFIX_DISPOSE(a,i);
+  }
+
+  ExecStatus
+  ClauseDB::propagate(Space& home, const ModEventDelta&) {
+    const int* s = c.start();
+    const int* l = c.lits();
+    // Assigning a literal adds its view to q
+    while (n_q > 0) {
+      int v = q[--n_q];
+      // The literal that has become false
+      int f = 2*v + x[v].val();
+      int p = -1;
+      int i = h[f];
+      while (i >= 0) {
+        int n = nw[i];
+        int o = l[w[i^1]];
+        if (!istrue(o)) {
+          int k = i >> 1;
+          int j = s[k];
+          while ((j < s[k+1]) &&
+                 ((j == w[i]) || (j == w[i^1]) || isfalse(l[j])))
+            j++;
+          if (j < s[k+1]) {
+            // Move the watch to a literal that is not false
+            w[i] = j;
+            if (p < 0)
+              h[f] = n;
+            else
+              nw[p] = n;
+            nw[i] = h[l[j]]; h[l[j]] = i;
+            i = n;
+            continue;
+          }
+          // All other literals are false, o must be true
+          if (isfalse(o))
+            return ES_FAILED;
+          GECODE_ME_CHECK(x[o >> 1].eq(home,1 ^ (o & 1)));
+        }
+        p = i; i = n;
+      }
+    }
+    return (n_a == x.size()) ? home.ES_SUBSUMED(*this) : ES_FIX;
+  }
+
+  ExecStatus
+  ClauseDB::post(Home home, ViewArray<BoolView>& x, const IntArgs& c) {
+    Region r;
+    // Translate literals and count clauses
+    int n = 0;
+    int m = 0;
+    int* l = r.alloc<int>(c.size()+1);
+    for (int i=0; i<c.size(); i++)
+      if (c[i] == 0) {
+        l[i] = -1; n++;
+      } else {
+        l[i] = (c[i] > 0) ? 2*(c[i]-1) : 2*(-c[i]-1)+1;
+        m++;
+      }
+    int ml = c.size();
+    if ((ml > 0) && (c[ml-1] != 0)) {
+      // The last clause need not be terminated
+      l[ml++] = -1; n++;
+    }
+    // Start of clause and whether clause is still to be considered
+    int* s = r.alloc<int>(n+1);
+    bool* a = r.alloc<bool>(n);
+    // Remove duplicate literals and tautologies, stamp is clause index
+    int* stamp = r.alloc<int>(2*x.size());
+    for (int i=2*x.size(); i--; )
+      stamp[i] = -1;
+    {
+      int k = 0;
+      int j = 0;
+      s[0] = 0; a[0] = true;
+      for (int i=0; i<ml; i++)
+        if (l[i] < 0) {
+          s[++k] = j;
+          if (k < n)
+            a[k] = true;
+        } else if (stamp[l[i] ^ 1] == k) {
+          a[k] = false;
+        } else if (stamp[l[i]] != k) {
+          stamp[l[i]] = k; l[j++] = l[i];
+        }
+    }
+    // Propagate unit clauses and drop satisfied clauses
+    bool unit;
+    do {
+      unit = false;
+      for (int i=0; i<n; i++)
+        if (a[i]) {
+          int nf = 0;
+          int u = -1;
+          for (int j=s[i]; j<s[i+1]; j++) {
+            BoolView v = x[l[j] >> 1];
+            if (v.none()) {
+              nf++; u = l[j];
+            } else if (v.val() != (l[j] & 1)) {
+              // The literal is true
+              a[i] = false; break;
+            }
+          }
+          if (!a[i])
+            continue;
+          if (nf == 0)
+            return ES_FAILED;
+          if (nf == 1) {
+            GECODE_ME_CHECK(x[u >> 1].eq(home,1 ^ (u & 1)));
+            a[i] = false; unit = true;
+          }
+        }
+    } while (unit);
+    // Renumber the views that still occur in clauses
+    int* vi = r.alloc<int>(x.size());
+    for (int i=x.size(); i--; )
+      vi[i] = -1;
+    int nx = 0;
+    int nc = 0;
+    int nl = 0;
+    for (int i=0; i<n; i++)
+      if (a[i]) {
+        int b = s[i];
+        s[nc] = nl;
+        for (int j=b; j<s[i+1]; j++)
+          if (x[l[j] >> 1].none()) {
+            int v = l[j] >> 1;
+            if (vi[v] < 0)
+              vi[v] = nx++;
+            l[nl++] = 2*vi[v] + (l[j] & 1);
+          }
+        nc++;
+      }
+    if (nc == 0)
+      return ES_OK;
+    s[nc] = nl;
+    ViewArray<BoolView> y(home,nx);
+    for (int i=x.size(); i--; )
+      if (vi[i] >= 0)
+        y[vi[i]] = x[i];
+    Clauses cs(nc,s,l);
+    (void) new (home) ClauseDB(home,y,cs);
+    return ES_OK;
+  }
+
+  size_t
+  ClauseDB::dispose(Space& home) {
+    home.ignore(*this,AP_DISPOSE);
+    for (Advisors<Idx> as(a); as(); ++as)
+      x[as.advisor().i].cancel(home,as.advisor());
+    a.dispose(home);
+    c.~Clauses();
+    (void) Propagator::dispose(home);
+    return sizeof(*this);
+  }
+
+}}}
+
+// STATISTICS: int-prop
@@ -0,0 +1,96 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Copyright:
+ *     Gecode contributors, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+namespace Gecode { namespace Int { namespace Bool {
+
+  /*
+   * Shared clauses
+   *
+   */
+  forceinline
+  ClauseDB::Clauses::ClauseArena::ClauseArena(int n0, int m)
+    : n(n0), s(heap.alloc<int>(n0+1)), l(heap.alloc<int>(m)) {}
+
+  forceinline
+  ClauseDB::Clauses::Clauses(void) {}
+
+  forceinline
+  ClauseDB::Clauses::Clauses(int n, const int* s, const int* l)
+    : SharedHandle(new ClauseArena(n,s[n])) {
+    ClauseArena* ca = static_cast<ClauseArena*>(object());
+    Heap::copy(ca->s,s,n+1);
+    Heap::copy(ca->l,l,s[n]);
+  }
+
+  forceinline int
+  ClauseDB::Clauses::clauses(void) const {
+    return static_cast<ClauseArena*>(object())->n;
+  }
+  forceinline const int*
+  ClauseDB::Clauses::start(void) const {
+    return static_cast<ClauseArena*>(object())->s;
+  }
+  forceinline const int*
+  ClauseDB::Clauses::lits(void) const {
+    return static_cast<ClauseArena*>(object())->l;
+  }
+
+
+  /*
+   * Index advisors
+   *
+   */
+  forceinline
+  ClauseDB::Idx::Idx(Space& home, Propagator& p, Council<Idx>& c, int i0)
+    : Advisor(home,p,c), i(i0) {}
+
+  forceinline
+  ClauseDB::Idx::Idx(Space& home, Idx& a)
+    : Advisor(home,a), i(a.i) {}
+
+
+  /*
+   * Clause database propagator
+   *
+   */
+  forceinline bool
+  ClauseDB::istrue(int l) const {
+    BoolView v = x[l >> 1];
+    return !v.none() && (v.val() != (l & 1));
+  }
+  forceinline bool
+  ClauseDB::isfalse(int l) const {
+    BoolView v = x[l >> 1];
+    return !v.none() && (v.val() == (l & 1));
+  }
+
+}}}
+
+// STATISTICS: int-prop
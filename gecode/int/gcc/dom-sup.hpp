@@ -1492,15 +1492,28 @@ namespace Gecode { namespace Int { namespace GCC {
       vals[i]->index(n_var + i);
     }
 
+    Region r;
     for (int i = n_var; i--; ) {
       if (vars[i]->noe > 1) {
+        // Collect values to remove (edges are sorted by increasing value)
+        int n = vars[i]->noe;
+        int* nq = r.alloc<int>(n);
+        int n_nq = 0;
         for (Edge* e = vars[i]->first(); e != NULL; e = e->next()) {
           if (!e->matched(bc) && !e->used(bc)) {
-            GECODE_ME_CHECK(x[i].nq(home, e->getVal()->val));
+            nq[n_nq++] = e->getVal()->val;
           } else {
             e->free(bc);
           }
         }
+        // Remove all values at once, so that propagators are notified once
+        if (n_nq == 1) {
+          GECODE_ME_CHECK(x[i].nq(home,nq[0]));
+        } else if (n_nq > 1) {
+          Iter::Values::Array rnq(nq,n_nq);
+          GECODE_ME_CHECK(x[i].minus_v(home,rnq,false));
+        }
+        r.free<int>(nq,n);
       }
     }
     return ES_OK;
@@ -32,12 +32,19 @@
  */
 
 #include <cfloat>
+#include <atomic>
 
 namespace Gecode {
 
   /**
    * \brief Class for action management
    *
+   * Action information is shared by all spaces (and hence all threads)
+   * that originate from the space for which it has been created.
+   * Action values are updated atomically and read with relaxed memory
+   * order, so recording action does not require a lock. Only rescaling
+   * all values (which is rare) takes the storage's mutex.
+   *
    */
   class Action : public SharedHandle {
   protected:
@@ -46,20 +53,22 @@ namespace Gecode {
     /// Object for storing action values
     class GECODE_VTABLE_EXPORT Storage : public SharedHandle::Object {
     public:
-      /// Mutex to synchronize globally shared access
-      GECODE_KERNEL_EXPORT static Support::Mutex m;
+      /// Mutex to synchronize rescaling
+      Support::Mutex m;
       /// Number of action values
       int n;
       /// Inverse decay factor
-      double invd;
+      std::atomic<double> invd;
       /// Action values (more follow)
-      double* a;
+      std::atomic<double>* a;
       /// Initialize action values
       template<class View>
       Storage(Home home, ViewArray<View>& x, double d,
               typename BranchTraits<typename View::VarType>::Merit bm);
       /// Update action value at position \a i
       void update(int i);
+      /// Return action value at position \a i
+      double value(int i) const;
       /// Delete object
       GECODE_KERNEL_EXPORT
       ~Storage(void);
@@ -70,10 +79,6 @@ namespace Gecode {
     void object(Storage& o);
     /// Update action value at position \a i
     void update(int i);
-    /// Acquire mutex
-    void acquire(void);
-    /// Release mutex
-    void release(void);
   public:
     /// \name Constructors and initialization
     //@{
@@ -257,15 +262,16 @@ namespace Gecode {
   Action::Storage::Storage(Home home, ViewArray<View>& x, double d,
                            typename
                            BranchTraits<typename View::VarType>::Merit bm)
-    : n(x.size()), invd(1.0 / d), a(heap.alloc<double>(x.size())) {
+    : n(x.size()), invd(1.0 / d),
+      a(heap.alloc<std::atomic<double> >(x.size())) {
     if (bm)
       for (int i=0; i<n; i++) {
         typename View::VarType xi(x[i].varimp());
-        a[i] = bm(home,xi,i);
+        a[i].store(bm(home,xi,i),std::memory_order_relaxed);
       }
     else
       for (int i=0; i<n; i++)
-        a[i] = 1.0;
+        a[i].store(1.0,std::memory_order_relaxed);
   }
   forceinline void
   Action::Storage::update(int i) {
@@ -274,10 +280,26 @@ namespace Gecode {
      * Niklas En, Niklas Srensson, SAT 2003.
      */
     assert((i >= 0) && (i < n));
-    a[i] = invd * (a[i] + 1.0);
-    if (a[i] > Kernel::Config::rescale_limit)
-      for (int j=0; j<n; j++)
-        a[j] *= Kernel::Config::rescale;
+    double d = invd.load(std::memory_order_relaxed);
+    double o = a[i].load(std::memory_order_relaxed);
+    while (!a[i].compare_exchange_weak(o, d * (o + 1.0),
+                                       std::memory_order_relaxed)) {}
+    if (d * (o + 1.0) > Kernel::Config::rescale_limit) {
+      m.acquire();
+      // Some other thread might have rescaled in the meantime
+      if (value(i) > Kernel::Config::rescale_limit)
+        for (int j=0; j<n; j++) {
+          double v = a[j].load(std::memory_order_relaxed);
+          while (!a[j].compare_exchange_weak(v, v * Kernel::Config::rescale,
+                                             std::memory_order_relaxed)) {}
+        }
+      m.release();
+    }
+  }
+  forceinline double
+  Action::Storage::value(int i) const {
+    assert((i >= 0) && (i < n));
+    return a[i].load(std::memory_order_relaxed);
   }
 
 
@@ -302,21 +324,12 @@ namespace Gecode {
   }
   forceinline double
   Action::operator [](int i) const {
-    assert((i >= 0) && (i < object().n));
-    return object().a[i];
+    return object().value(i);
   }
   forceinline int
   Action::size(void) const {
     return object().n;
   }
-  forceinline void
-  Action::acquire(void) {
-    object().m.acquire();
-  }
-  forceinline void
-  Action::release(void) {
-    object().m.release();
-  }
 
 
   forceinline
@@ -415,8 +428,6 @@ namespace Gecode {
   template<class View>
   ExecStatus
   Action::Recorder<View>::propagate(Space& home, const ModEventDelta&) {
-    // Lock action information
-    a.acquire();
     for (Advisors<Idx> as(c); as(); ++as) {
       int i = as.advisor().idx();
       if (as.advisor().marked()) {
@@ -426,7 +437,6 @@ namespace Gecode {
           as.advisor().dispose(home,c);
       }
     }
-    a.release();
     return c.empty() ? home.ES_SUBSUMED(*this) : ES_FIX;
   }
 
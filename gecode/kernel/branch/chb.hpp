@@ -32,6 +32,7 @@
  */
 
 #include <cfloat>
+#include <atomic>
 
 namespace Gecode {
 
@@ -42,6 +43,13 @@ namespace Gecode {
    * Branching Heuristic for SAT Solvers, Jia Hui Liang, Vijay Ganesh,
    * Pascal Poupart, Krzysztof Czarnecki, AAAI 2016, pages 3434-3440.
    *
+   * CHB information is shared by all spaces (and hence all threads)
+   * that originate from the space for which it has been created. All
+   * information is updated atomically and read with relaxed memory
+   * order, so recording does not require a lock. With several threads,
+   * an update might be based on a failure count or alpha value that
+   * has been changed concurrently by another thread.
+   *
    */
   class CHB : public SharedHandle {
   protected:
@@ -51,21 +59,19 @@ namespace Gecode {
     class Info {
     public:
       /// Last failure
-      unsigned long long int lf;
+      std::atomic<unsigned long long int> lf;
       /// Q-score
-      double qs;
+      std::atomic<double> qs;
     };
     /// Object for storing chb information
     class GECODE_VTABLE_EXPORT Storage : public SharedHandle::Object {
     public:
-      /// Mutex to synchronize globally shared access
-      GECODE_KERNEL_EXPORT static Support::Mutex m;
       /// Number of chb values
       int n;
       /// Number of failures
-      unsigned long int nf;
+      std::atomic<unsigned long int> nf;
       /// Alpha value
-      double alpha;
+      std::atomic<double> alpha;
       /// CHB information
       Info* chb;
       /// Initialize CHB info
@@ -86,10 +92,6 @@ namespace Gecode {
     void object(Storage& o);
     /// Update chb value at position \a i
     void update(int i);
-    /// Acquire mutex
-    void acquire(void);
-    /// Release mutex
-    void release(void);
     /// Bump failure count and alpha
     void bump(void);
     /// Update chb information at position \a i
@@ -271,33 +273,42 @@ namespace Gecode {
     if (bm) {
       for (int i=0; i<n; i++) {
         typename View::VarType xi(x[i].varimp());
-        chb[i].lf = 0U;
-        chb[i].qs = bm(home,xi,i);
+        chb[i].lf.store(0U,std::memory_order_relaxed);
+        chb[i].qs.store(bm(home,xi,i),std::memory_order_relaxed);
       }
     } else {
       for (int i=0; i<n; i++) {
-        chb[i].lf = 0U;
-        chb[i].qs = Kernel::Config::chb_qscore_init;
+        chb[i].lf.store(0U,std::memory_order_relaxed);
+        chb[i].qs.store(Kernel::Config::chb_qscore_init,
+                        std::memory_order_relaxed);
       }
     }
   }
   forceinline void
   CHB::Storage::bump(void) {
-    nf++;
-    if (alpha > Kernel::Config::chb_alpha_limit) {
-      alpha -= Kernel::Config::chb_alpha_decrement;
-    }
+    nf.fetch_add(1UL,std::memory_order_relaxed);
+    double a = alpha.load(std::memory_order_relaxed);
+    while ((a > Kernel::Config::chb_alpha_limit) &&
+           !alpha.compare_exchange_weak(a,
+                                        a - Kernel::Config::chb_alpha_decrement,
+                                        std::memory_order_relaxed)) {}
   }
   forceinline void
   CHB::Storage::update(int i, bool failed) {
+    unsigned long long int f = nf.load(std::memory_order_relaxed);
+    double a = alpha.load(std::memory_order_relaxed);
+    double reward;
     if (failed) {
-      chb[i].lf = nf;
-      double reward = 1.0 / (nf - chb[i].lf + 1);
-      chb[i].qs = (1.0 - alpha) * chb[i].qs + alpha * reward;
+      chb[i].lf.store(f,std::memory_order_relaxed);
+      reward = 1.0;
     } else {
-      double reward = 0.9 / (nf - chb[i].lf + 1);
-      chb[i].qs = (1.0 - alpha) * chb[i].qs + alpha * reward;
+      unsigned long long int l = chb[i].lf.load(std::memory_order_relaxed);
+      // Another thread might have recorded a more recent failure
+      reward = 0.9 / (((f > l) ? f - l : 0ULL) + 1);
     }
+    double q = chb[i].qs.load(std::memory_order_relaxed);
+    while (!chb[i].qs.compare_exchange_weak(q, (1.0 - a) * q + a * reward,
+                                            std::memory_order_relaxed)) {}
   }
 
 
@@ -319,21 +330,13 @@ namespace Gecode {
   forceinline double
   CHB::operator [](int i) const {
     assert((i >= 0) && (i < object().n));
-    return object().chb[i].qs;
+    return object().chb[i].qs.load(std::memory_order_relaxed);
   }
   forceinline int
   CHB::size(void) const {
     return object().n;
   }
   forceinline void
-  CHB::acquire(void) {
-    object().m.acquire();
-  }
-  forceinline void
-  CHB::release(void) {
-    object().m.release();
-  }
-  forceinline void
   CHB::bump(void) {
     object().bump();
   }
@@ -438,8 +441,6 @@ namespace Gecode {
   template<class View>
   ExecStatus
   CHB::Recorder<View>::propagate(Space& home, const ModEventDelta&) {
-    // Lock chb information
-    chb.acquire();
     if (home.failed()) {
       chb.bump();
       for (Advisors<Idx> as(c); as(); ++as) {
@@ -462,7 +463,6 @@ namespace Gecode {
         }
       }
     }
-    chb.release();
     return c.empty() ? home.ES_SUBSUMED(*this) : ES_FIX;
   }
 
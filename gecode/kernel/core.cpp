@@ -37,6 +37,8 @@
 
 #include <gecode/kernel.hh>
 
+#include <typeinfo>
+
 namespace Gecode {
 
   /*
@@ -82,6 +84,10 @@ namespace Gecode {
   NoGoods::post(Space&) const {
   }
 
+  void
+  NoGoods::archive(Archive&) const {
+  }
+
   NoGoods NoGoods::eng;
 
   /*
@@ -133,6 +139,7 @@ namespace Gecode {
       pc.p.queue[i].init();
     pc.p.bid_sc = (reserved_bid+1) << sc_bits;
     pc.p.n_sub  = 0;
+    pc.p.n_enqueue = 0;
     pc.p.vti.other();
   }
 
@@ -248,6 +255,75 @@ namespace Gecode {
     }
   }
 
+  namespace Kernel {
+
+    /// Propagator in a batch together with its ordering keys
+    class BatchEntry {
+    public:
+      /// The propagator
+      Propagator* p;
+      /// Key for the class of the propagator
+      size_t c;
+      /// Accumulated failure count of the propagator
+      double afc;
+    };
+
+    /// Order batch entries by class
+    class BatchByClass {
+    public:
+      /// Test whether \a x must be executed before \a y
+      bool operator ()(const BatchEntry& x, const BatchEntry& y) const {
+        return x.c < y.c;
+      }
+    };
+
+    /// Order batch entries by decreasing AFC and then by class
+    class BatchByAFC {
+    public:
+      /// Test whether \a x must be executed before \a y
+      bool operator ()(const BatchEntry& x, const BatchEntry& y) const {
+        return (x.afc > y.afc) || ((x.afc == y.afc) && (x.c < y.c));
+      }
+    };
+
+  }
+
+  void
+  Space::batch(ActorLink* q, ActorLink& b) {
+    b.init();
+    int n = 0;
+    for (ActorLink* a = q->next(); a != q; a = a->next())
+      n++;
+    if (n == 1) {
+      ActorLink* a = q->next();
+      a->unlink(); b.tail(a);
+      return;
+    }
+    Region r;
+    Kernel::BatchEntry* e = r.alloc<Kernel::BatchEntry>(n);
+    {
+      int i = 0;
+      for (ActorLink* a = q->next(); a != q; a = a->next()) {
+        Propagator* p = Propagator::cast(a);
+        e[i].p = p;
+        e[i].c = typeid(*p).hash_code();
+        e[i].afc = (pc.p.bid_sc & sc_afc) ? p->afc() : 0.0;
+        i++;
+      }
+    }
+    if (pc.p.bid_sc & sc_afc) {
+      Kernel::BatchByAFC o;
+      Support::quicksort<Kernel::BatchEntry,Kernel::BatchByAFC>(e,n,o);
+    } else {
+      Kernel::BatchByClass o;
+      Support::quicksort<Kernel::BatchEntry,Kernel::BatchByClass>(e,n,o);
+    }
+    for (int i=0; i<n; i++) {
+      ActorLink* a = ActorLink::cast(e[i].p);
+      a->unlink(); b.tail(a);
+    }
+  }
+
   SpaceStatus
   Space::status(StatusStatistics& stat) {
     // Check whether space is failed
@@ -258,12 +334,16 @@ namespace Gecode {
     // Check whether space is stable but not failed
     if (pc.p.active >= &pc.p.queue[0]) {
       ModEventDelta med_o;
+      // Number of enqueue operations before executing a propagator
+      unsigned int n_enqueue;
       if ((pc.p.bid_sc & ((1 << sc_bits) - 1)) == 0) {
         // No support for disabled propagators and tracing
         // Check whether space is stable but not failed
         goto f_unstable;
       f_execute:
         stat.propagate++;
+        stat.propagate_cost[pc.p.active - &pc.p.queue[0]]++;
+        n_enqueue = pc.p.n_enqueue;
         // Keep old modification event delta
         med_o = p->u.med;
         // Clear med but leave propagator in queue
@@ -290,6 +370,8 @@ namespace Gecode {
           }
           // Fall through
         case ES_FIX:
+          if (pc.p.n_enqueue == n_enqueue)
+            stat.idle++;
           // Clear med
           p->u.med = 0;
           // Put into idle queue
@@ -324,8 +406,10 @@ namespace Gecode {
         goto d_unstable;
       d_execute:
         stat.propagate++;
+        stat.propagate_cost[pc.p.active - &pc.p.queue[0]]++;
         if (p->disabled())
           goto d_put_into_idle;
+        n_enqueue = pc.p.n_enqueue;
         // Keep old modification event delta
         med_o = p->u.med;
         // Clear med but leave propagator in queue
@@ -352,6 +436,8 @@ namespace Gecode {
           }
           // Fall through
         case ES_FIX:
+          if (pc.p.n_enqueue == n_enqueue)
+            stat.idle++;
         d_put_into_idle:
           // Clear med
           p->u.med = 0;
@@ -382,7 +468,7 @@ namespace Gecode {
           GECODE_NEVER;
         }
       d_stable: ;
-      } else {
+      } else if ((pc.p.bid_sc & (sc_class | sc_afc)) == 0) {
         // Support disabled propagators and tracing
 
 #define GECODE_STATUS_TRACE(q,s) \
@@ -401,9 +487,11 @@ namespace Gecode {
 
       t_execute:
         stat.propagate++;
+        stat.propagate_cost[pc.p.active - &pc.p.queue[0]]++;
         if (p->disabled())
           goto t_put_into_idle;
         pc.p.vti.propagator(*p);
+        n_enqueue = pc.p.n_enqueue;
         // Keep old modification event delta
         med_o = p->u.med;
         // Clear med but leave propagator in queue
@@ -433,6 +521,8 @@ namespace Gecode {
           // Fall through
         case ES_FIX:
           GECODE_STATUS_TRACE(p,FIX);
+          if (pc.p.n_enqueue == n_enqueue)
+            stat.idle++;
         t_put_into_idle:
           // Clear med
           p->u.med = 0;
@@ -467,10 +557,89 @@ namespace Gecode {
       t_stable:
         // Restore post information
         pc.p.vti = vti;
+      } else {
+        // Support batch execution, disabled propagators, and tracing
+
+        // Find a non-disabled tracer recorder (possibly null)
+        TraceRecorder* tr =
+          (pc.p.bid_sc & sc_trace) ? findtracerecorder() : NULL;
+        // Remember post information
+        ViewTraceInfo vti(pc.p.vti);
+        // Propagators of the batch currently executed
+        ActorLink b;
+        do {
+          assert(pc.p.active >= &pc.p.queue[0]);
+          ActorLink* q = pc.p.active;
+          if (q->empty()) {
+            pc.p.active--;
+            continue;
+          }
+          batch(q,b);
+          /*
+           * Propagators that are scheduled while the batch is executed
+           * (including propagators from the batch) are put into their
+           * queue and are executed after the batch.
+           */
+          while (!b.empty()) {
+            p = Propagator::cast(b.next());
+            stat.propagate++;
+            stat.propagate_cost[q - &pc.p.queue[0]]++;
+            if (p->disabled()) {
+              p->u.med = 0;
+              p->unlink(); pl.head(p);
+              continue;
+            }
+            pc.p.vti.propagator(*p);
+            n_enqueue = pc.p.n_enqueue;
+            // Keep old modification event delta
+            med_o = p->u.med;
+            // Clear med but leave propagator in batch
+            p->u.med = 0;
+            switch (p->propagate(*this,med_o)) {
+            case ES_FAILED:
+              GECODE_STATUS_TRACE(p,FAILED);
+              // Put remaining propagators back into their queue
+              while (!b.empty()) {
+                ActorLink* a = b.prev();
+                a->unlink(); q->head(a);
+              }
+              goto failed;
+            case ES_NOFIX:
+              if (p->u.med != 0) {
+                GECODE_STATUS_TRACE(p,NOFIX);
+                break;
+              }
+              // Fall through
+            case ES_FIX:
+              GECODE_STATUS_TRACE(p,FIX);
+              if (pc.p.n_enqueue == n_enqueue)
+                stat.idle++;
+              // Clear med
+              p->u.med = 0;
+              // Put into idle queue
+              p->unlink(); pl.head(p);
+              break;
+            case __ES_SUBSUMED:
+              GECODE_STATUS_TRACE(NULL,SUBSUMED);
+              p->unlink(); rfree(p,p->u.size);
+              break;
+            case __ES_PARTIAL:
+              GECODE_STATUS_TRACE(p,NOFIX);
+              // Schedule propagator with specified propagator events
+              assert(p->u.med != 0);
+              enqueue(p);
+              break;
+            default:
+              GECODE_NEVER;
+            }
+          }
+        } while (pc.p.active >= &pc.p.queue[0]);
+        // Restore post information
+        pc.p.vti = vti;
+      }
 
 #undef GECODE_STATUS_TRACE
 
-      }
     }
 
     /*
@@ -830,6 +999,7 @@ namespace Gecode {
     // Copy propagation only data
     c->pc.p.n_sub  = pc.p.n_sub;
     c->pc.p.bid_sc = pc.p.bid_sc;
+    c->pc.p.n_enqueue = 0;
 
     // Reset execution information
     c->pc.p.vti.other(); pc.p.vti.other();
@@ -1595,6 +1595,9 @@ namespace Gecode {
     /// Post no-goods
     GECODE_KERNEL_EXPORT
     virtual void post(Space& home) const;
+    /// Archive no-goods into \a e (the no-goods are empty)
+    GECODE_KERNEL_EXPORT
+    virtual void archive(Archive& e) const;
     /// Return number of no-goods posted
     unsigned long int ng(void) const;
     /// %Set number of no-goods posted to \a n
@@ -1630,6 +1633,8 @@ namespace Gecode {
     const unsigned long int s;
     /// Number of failures since last restart
     const unsigned long int f;
+    /// Whether the search space of the last restart has been exhausted
+    const bool e;
     /// Last solution found
     const Space* l;
     /// No-goods from restart
@@ -1648,7 +1653,8 @@ namespace Gecode {
              unsigned long int s,
              unsigned long int f,
              const Space* l,
-             NoGoods& ng);
+             NoGoods& ng,
+             bool e=false);
     /// Constructor for portfolio-based engine
     MetaInfo(unsigned int a);
     //@}
@@ -1662,6 +1668,14 @@ namespace Gecode {
     unsigned long int solution(void) const;
     /// Return number of failures since last restart
     unsigned long int fail(void) const;
+    /**
+     * \brief Return whether the last restart has exhausted its search space
+     *
+     * Only true if the restart neither found a solution nor was stopped
+     * by its cutoff, that is, the search space explored after the last
+     * restart (for example, a neighborhood in LNS) contains no solution.
+     */
+    bool exhausted(void) const;
     /// Return last solution found (possibly NULL)
     const Space* last(void) const;
     /// Return no-goods recorded from restart
@@ -1684,6 +1698,41 @@ namespace Gecode {
     SS_BRANCH  ///< %Space must be branched (at least one brancher left)
   };
 
+  /**
+   * \brief Propagator scheduling
+   *
+   * Defines in which order scheduled propagators are executed by
+   * Space::status. With any scheduling, cheaper propagators are
+   * executed before more expensive propagators.
+   *
+   * \ingroup TaskSearch
+   */
+  enum PropagatorScheduling {
+    /**
+     * \brief Execute propagators one at a time (default)
+     *
+     * Propagators of the same cost are executed in the order in
+     * which they have been scheduled.
+     */
+    PS_FIFO,
+    /**
+     * \brief Execute propagators in batches grouped by class
+     *
+     * All propagators of the same cost that are scheduled when
+     * a batch starts are executed before any newly scheduled propagator,
+     * where propagators of the same class are executed one after the other.
+     */
+    PS_CLASS,
+    /**
+     * \brief Execute propagators in batches ordered by AFC
+     *
+     * Like PS_CLASS, but propagators in a batch are executed by
+     * decreasing accumulated failure count, so that propagators that
+     * are likely to fail are executed first.
+     */
+    PS_AFC
+  };
+
   /**
    * \brief %Statistics for execution of status
    *
@@ -1692,6 +1741,10 @@ namespace Gecode {
   public:
     /// Number of propagator executions
     unsigned long int propagate;
+    /// Number of propagator executions per cost
+    unsigned long int propagate_cost[PropCost::AC_MAX+1];
+    /// Number of propagator executions that did not schedule any propagator
+    unsigned long int idle;
     /// Initialize
     StatusStatistics(void);
     /// Reset information
@@ -1705,9 +1758,23 @@ namespace Gecode {
   /**
    * \brief %Statistics for execution of clone
    *
+   * The memory information is shared by all spaces that have been
+   * cloned from the same space and is recorded when a clone is created.
+   * Hence, when statistics are combined, the maximum is taken.
+   *
    */
   class CloneStatistics {
   public:
+    /// Number of clones created
+    unsigned long int clone;
+    /// Memory (in bytes) allocated by the created clones
+    unsigned long int clone_size;
+    /// Peak memory (in bytes) of heap chunks used by spaces
+    unsigned long int memory;
+    /// Number of heap chunks requested by spaces
+    unsigned long int chunk;
+    /// Number of requested heap chunks that have been reused from a cache
+    unsigned long int chunk_reuse;
     /// Initialize
     CloneStatistics(void);
     /// Reset information
@@ -1804,13 +1871,17 @@ namespace Gecode {
     static const unsigned reserved_bid = 0U;
 
     /// Number of bits for status control
-    static const unsigned int sc_bits = 2;
+    static const unsigned int sc_bits = 4;
     /// No special features activated
     static const unsigned int sc_fast = 0;
     /// Disabled propagators are supported
     static const unsigned int sc_disabled = 1;
     /// Tracing is supported
     static const unsigned int sc_trace = 2;
+    /// Propagators are executed in batches grouped by class
+    static const unsigned int sc_class = 4;
+    /// Propagators are executed in batches ordered by AFC
+    static const unsigned int sc_afc = 8;
 
     union {
       /// Data only available during propagation or branching
@@ -1839,6 +1910,8 @@ namespace Gecode {
         unsigned int bid_sc;
         /// Number of subscriptions
         unsigned int n_sub;
+        /// Number of times a propagator has been enqueued
+        unsigned int n_enqueue;
         /// View trace information
         ViewTraceInfo vti;
       } p;
@@ -1854,6 +1927,8 @@ namespace Gecode {
     } pc;
     /// Put propagator \a p into right queue
     void enqueue(Propagator* p);
+    /// Move propagators from queue \a q to \a b in batch execution order
+    void batch(ActorLink* q, ActorLink& b);
     /**
      * \name update, and dispose variables
      */
@@ -2104,6 +2179,19 @@ namespace Gecode {
      */
     GECODE_KERNEL_EXPORT
     SpaceStatus status(StatusStatistics& stat=unused_status);
+    /**
+     * \brief Set propagator scheduling to \a ps
+     *
+     * The scheduling is inherited by all clones of the space.
+     *
+     * \ingroup TaskSearch
+     */
+    void scheduling(PropagatorScheduling ps);
+    /**
+     * \brief Return propagator scheduling
+     * \ingroup TaskSearch
+     */
+    PropagatorScheduling scheduling(void) const;
 
     /**
      * \brief Create new choice for current brancher
@@ -2151,6 +2239,19 @@ namespace Gecode {
     GECODE_KERNEL_EXPORT
     const Choice* choice(Archive& e) const;
 
+    /**
+     * \brief Return identity of the next brancher to be created
+     *
+     * All branchers that are created later in this space or in any of
+     * its clones have an identity that is not smaller than the returned
+     * value. Hence, a choice whose brancher has a smaller identity can
+     * be used with all clones of the space, even if different branchers
+     * have been created in the clones later on.
+     *
+     * \ingroup TaskSearch
+     */
+    unsigned int brancherid(void) const;
+
     /**
      * \brief Clone space
      *
@@ -3071,12 +3172,14 @@ namespace Gecode {
                      unsigned long int s0,
                      unsigned long int f0,
                      const Space* l0,
-                     NoGoods& ng0)
-    : t(RESTART), r(r0), s(s0), f(f0), l(l0), ng(ng0), a(0) {}
+                     NoGoods& ng0,
+                     bool e0)
+    : t(RESTART), r(r0), s(s0), f(f0), e(e0), l(l0), ng(ng0), a(0) {}
 
   forceinline
   MetaInfo::MetaInfo(unsigned int a0)
-    : t(PORTFOLIO), r(0), s(0), f(0), l(NULL), ng(NoGoods::eng), a(a0) {}
+    : t(PORTFOLIO), r(0), s(0), f(0), e(false), l(NULL), ng(NoGoods::eng),
+      a(a0) {}
 
   forceinline MetaInfo::Type
   MetaInfo::type(void) const {
@@ -3097,6 +3200,11 @@ namespace Gecode {
     assert(type() == RESTART);
     return f;
   }
+  forceinline bool
+  MetaInfo::exhausted(void) const {
+    assert(type() == RESTART);
+    return e;
+  }
   forceinline const Space*
   MetaInfo::last(void) const {
     assert(type() == RESTART);
@@ -3221,11 +3329,18 @@ namespace Gecode {
   }
 
   forceinline Space*
-  Space::clone(CloneStatistics&) const {
+  Space::clone(CloneStatistics& stat) const {
     // Clone is only const for search engines. During cloning, several data
     // structures are updated (e.g. forwarding pointers), so we have to
     // cast away the constness.
-    return const_cast<Space*>(this)->_clone();
+    Space* c = const_cast<Space*>(this)->_clone();
+    stat.clone++;
+    stat.clone_size += c->mm.allocated();
+    const Kernel::SharedMemory& sm = ssd.data().sm;
+    stat.memory = sm.peak();
+    stat.chunk = sm.chunk();
+    stat.chunk_reuse = sm.chunk_reuse();
+    return c;
   }
 
   forceinline void
@@ -3523,7 +3638,7 @@ namespace Gecode {
 
   forceinline double
   Propagator::afc(void) const {
-    return const_cast<Propagator&>(*this).gpi().afc;
+    return const_cast<Propagator&>(*this).gpi().value();
   }
 
 #ifdef GECODE_HAS_CBS
@@ -4019,6 +4134,7 @@ namespace Gecode {
    */
   forceinline void
   Space::enqueue(Propagator* p) {
+    pc.p.n_enqueue++;
     ActorLink::cast(p)->unlink();
     ActorLink* c = &pc.p.queue[p->cost(*this,p->u.med).ac];
     c->tail(ActorLink::cast(p));
@@ -4049,6 +4165,34 @@ namespace Gecode {
     return s.failed();
   }
 
+  forceinline void
+  Space::scheduling(PropagatorScheduling ps) {
+    pc.p.bid_sc &= ~(sc_class | sc_afc);
+    switch (ps) {
+    case PS_FIFO:
+      break;
+    case PS_CLASS:
+      pc.p.bid_sc |= sc_class; break;
+    case PS_AFC:
+      pc.p.bid_sc |= sc_afc; break;
+    default:
+      GECODE_NEVER;
+    }
+  }
+  forceinline PropagatorScheduling
+  Space::scheduling(void) const {
+    if (pc.p.bid_sc & sc_afc)
+      return PS_AFC;
+    if (pc.p.bid_sc & sc_class)
+      return PS_CLASS;
+    return PS_FIFO;
+  }
+
+  forceinline unsigned int
+  Space::brancherid(void) const {
+    return pc.p.bid_sc >> sc_bits;
+  }
+
   forceinline bool
   Space::stable(void) const {
     return ((pc.p.active < &pc.p.queue[0]) ||
@@ -4689,6 +4833,9 @@ namespace Gecode {
   forceinline void
   StatusStatistics::reset(void) {
     propagate = 0;
+    for (int i=0; i<=PropCost::AC_MAX; i++)
+      propagate_cost[i] = 0;
+    idle = 0;
   }
   forceinline
   StatusStatistics::StatusStatistics(void) {
@@ -4697,6 +4844,9 @@ namespace Gecode {
   forceinline StatusStatistics&
   StatusStatistics::operator +=(const StatusStatistics& s) {
     propagate += s.propagate;
+    for (int i=0; i<=PropCost::AC_MAX; i++)
+      propagate_cost[i] += s.propagate_cost[i];
+    idle += s.idle;
     return *this;
   }
   forceinline StatusStatistics
@@ -4706,19 +4856,30 @@ namespace Gecode {
   }
 
   forceinline void
-  CloneStatistics::reset(void) {}
+  CloneStatistics::reset(void) {
+    clone = 0;
+    clone_size = 0;
+    memory = 0;
+    chunk = 0;
+    chunk_reuse = 0;
+  }
 
   forceinline
   CloneStatistics::CloneStatistics(void) {
     reset();
   }
   forceinline CloneStatistics
-  CloneStatistics::operator +(const CloneStatistics&) {
-    CloneStatistics s;
-    return s;
+  CloneStatistics::operator +(const CloneStatistics& s) {
+    CloneStatistics t(s);
+    return t += *this;
   }
   forceinline CloneStatistics&
-  CloneStatistics::operator +=(const CloneStatistics&) {
+  CloneStatistics::operator +=(const CloneStatistics& s) {
+    clone += s.clone;
+    clone_size += s.clone_size;
+    memory = std::max(memory,s.memory);
+    chunk = std::max(chunk,s.chunk);
+    chunk_reuse = std::max(chunk_reuse,s.chunk_reuse);
     return *this;
   }
 
@@ -32,10 +32,22 @@
  */
 
 #include <cmath>
+#include <atomic>
 
 namespace Gecode { namespace Kernel {
 
-  /// Global propagator information
+  /**
+   * \brief Global propagator information
+   *
+   * The information is shared among all spaces that originate from
+   * the same space and hence possibly among several threads. Recording
+   * failures and reading afc values does not require a lock: afc values
+   * are updated atomically by compare and swap and read with relaxed
+   * memory order. Hence a reader might see a value that misses failures
+   * recorded concurrently by other threads, but no failure is ever lost.
+   *
+   * Allocating information and rescaling requires the mutex.
+   */
   class GPI {
   public:
     /// Class for storing propagator information
@@ -46,9 +58,13 @@ namespace Gecode { namespace Kernel {
       /// Group identifier
       unsigned int gid;
       /// The afc value
-      double afc;
+      std::atomic<double> afc;
       /// Initialize
       void init(unsigned int pid, unsigned int gid);
+      /// Return afc value
+      double value(void) const;
+      /// Scale afc value by \a f and add \a a, return new value
+      double scale(double f, double a);
     };
   private:
     /// Block of propagator information
@@ -70,7 +86,7 @@ namespace Gecode { namespace Kernel {
     /// The current block
     Block* b;
     /// The inverse decay factor
-    double invd;
+    std::atomic<double> invd;
     /// Next free propagator id
     unsigned int npid;
     /// Whether to unshare
@@ -103,7 +119,22 @@ namespace Gecode { namespace Kernel {
 
   forceinline void
   GPI::Info::init(unsigned int pid0, unsigned int gid0) {
-    pid=pid0; gid=gid0; afc=1.0;
+    pid=pid0; gid=gid0; afc.store(1.0,std::memory_order_relaxed);
+  }
+
+  forceinline double
+  GPI::Info::value(void) const {
+    return afc.load(std::memory_order_relaxed);
+  }
+
+  forceinline double
+  GPI::Info::scale(double f, double a) {
+    double o = afc.load(std::memory_order_relaxed);
+    double n;
+    do {
+      n = f * (o + a);
+    } while (!afc.compare_exchange_weak(o,n,std::memory_order_relaxed));
+    return n;
   }
 
 
@@ -114,7 +145,7 @@ namespace Gecode { namespace Kernel {
   forceinline void
   GPI::Block::rescale(void) {
     for (int i=free; i < n_info; i++)
-      info[i].afc *= Kernel::Config::rescale;
+      (void) info[i].scale(Kernel::Config::rescale,0.0);
   }
 
 
@@ -124,21 +155,20 @@ namespace Gecode { namespace Kernel {
 
   forceinline void
   GPI::fail(Info& c) {
-    m.acquire();
-    c.afc = invd * (c.afc + 1.0);
-    if (c.afc > Kernel::Config::rescale_limit)
-      for (Block* i = b; i != NULL; i = i->next)
-        i->rescale();
-    m.release();
+    if (c.scale(invd.load(std::memory_order_relaxed),1.0) >
+        Kernel::Config::rescale_limit) {
+      m.acquire();
+      // Some other thread might have rescaled in the meantime
+      if (c.value() > Kernel::Config::rescale_limit)
+        for (Block* i = b; i != NULL; i = i->next)
+          i->rescale();
+      m.release();
+    }
   }
 
   forceinline double
   GPI::decay(void) const {
-    double d;
-    const_cast<GPI&>(*this).m.acquire();
-    d = 1.0 / invd;
-    const_cast<GPI&>(*this).m.release();
-    return d;
+    return 1.0 / invd.load(std::memory_order_relaxed);
   }
 
   forceinline unsigned int
@@ -161,9 +191,7 @@ namespace Gecode { namespace Kernel {
 
   forceinline void
   GPI::decay(double d) {
-    m.acquire();
-    invd = 1.0 / d;
-    m.release();
+    invd.store(1.0 / d, std::memory_order_relaxed);
   }
 
   forceinline GPI::Info*
@@ -45,6 +45,13 @@ namespace Gecode { namespace Kernel {
      * \brief How many heap chunks should be cached at most
      */
     const unsigned int n_hc_cache = 4*4;
+    /**
+     * \brief How many heap chunks should be cached at most per thread
+     *
+     * If a thread has cached \a n_hc_thread_cache heap chunks, half
+     * of them are handed over to the shared cache.
+     */
+    const unsigned int n_hc_thread_cache = 4*2;
 
     /**
      * \brief Minimal size of a heap chunk requested from the OS
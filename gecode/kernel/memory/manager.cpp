@@ -40,6 +40,11 @@ namespace Gecode { namespace Kernel {
     return _m;
   }
 
+  ThreadMemory& SharedMemory::local(void) {
+    static thread_local ThreadMemory _t;
+    return _t;
+  }
+
   void
   MemoryManager::alloc_refill(SharedMemory& sm, size_t sz) {
     // Try to reuse the not used memory
@@ -38,6 +38,8 @@
  *
  */
 
+#include <atomic>
+
 namespace Gecode { namespace Kernel {
 
   /// Memory chunk with size information
@@ -56,7 +58,29 @@ namespace Gecode { namespace Kernel {
     double area[1];
   };
 
-  /// Shared object for several memory areas
+  /// Heap chunks cached by a single thread
+  class ThreadMemory {
+  public:
+    /// How many heap chunks are cached
+    unsigned int n_hc;
+    /// A list of cached heap chunks
+    HeapChunk* hc;
+    /// Initialize
+    ThreadMemory(void);
+    /// Destructor (frees all cached heap chunks)
+    ~ThreadMemory(void);
+  };
+
+  /**
+   * \brief Shared object for several memory areas
+   *
+   * Heap chunks are first taken from and returned to a cache that
+   * is private to the current thread and hence requires no
+   * synchronization. Only if the thread's cache is empty or full,
+   * heap chunks are taken from or handed over to a cache that is
+   * shared by all threads.
+   *
+   */
   class SharedMemory {
   private:
     /// The components for shared heap memory
@@ -66,8 +90,20 @@ namespace Gecode { namespace Kernel {
       /// A list of cached heap chunks
       HeapChunk* hc;
     } heap;
+    /// Memory (in bytes) of heap chunks currently in use
+    std::atomic<size_t> _used;
+    /// Peak memory (in bytes) of heap chunks in use
+    std::atomic<size_t> _peak;
+    /// Number of requested heap chunks
+    std::atomic<unsigned long int> _chunk;
+    /// Number of requested heap chunks taken from a cache
+    std::atomic<unsigned long int> _chunk_reuse;
     /// A mutex for access
     GECODE_KERNEL_EXPORT static Support::Mutex& m(void);
+    /// Return heap chunk cache of current thread
+    GECODE_KERNEL_EXPORT static ThreadMemory& local(void);
+    /// Account for heap chunk \a hc being used
+    void use(HeapChunk* hc, bool reuse);
   public:
     /// Initialize
     SharedMemory(void);
@@ -80,6 +116,15 @@ namespace Gecode { namespace Kernel {
     /// Free heap chunk (or cache for later)
     void free(HeapChunk* hc);
     //@}
+    /// \name Memory statistics
+    //@{
+    /// Return peak memory (in bytes) of heap chunks in use
+    size_t peak(void) const;
+    /// Return number of requested heap chunks
+    unsigned long int chunk(void) const;
+    /// Return number of requested heap chunks taken from a cache
+    unsigned long int chunk_reuse(void) const;
+    //@}
   };
 
 
@@ -145,6 +190,8 @@ namespace Gecode { namespace Kernel {
     void* alloc(SharedMemory& sm, size_t s);
     /// Get the memory area for subscriptions
     void* subscriptions(void) const;
+    /// Return memory (in bytes) allocated from the heap chunks
+    size_t allocated(void) const;
 
   private:
     /// Start of free lists
@@ -181,7 +228,20 @@ namespace Gecode { namespace Kernel {
    */
 
   forceinline
-  SharedMemory::SharedMemory(void) {
+  ThreadMemory::ThreadMemory(void)
+    : n_hc(0), hc(NULL) {}
+  forceinline
+  ThreadMemory::~ThreadMemory(void) {
+    while (hc != NULL) {
+      HeapChunk* t = hc;
+      hc = static_cast<HeapChunk*>(t->next);
+      Gecode::heap.rfree(t);
+    }
+  }
+
+  forceinline
+  SharedMemory::SharedMemory(void)
+    : _used(0), _peak(0), _chunk(0), _chunk_reuse(0) {
     heap.n_hc = 0;
     heap.hc = NULL;
   }
@@ -194,37 +254,88 @@ namespace Gecode { namespace Kernel {
     }
   }
 
+  forceinline void
+  SharedMemory::use(HeapChunk* hc, bool reuse) {
+    _chunk.fetch_add(1UL,std::memory_order_relaxed);
+    if (reuse)
+      _chunk_reuse.fetch_add(1UL,std::memory_order_relaxed);
+    size_t u = _used.fetch_add(hc->size,std::memory_order_relaxed) + hc->size;
+    size_t p = _peak.load(std::memory_order_relaxed);
+    while ((u > p) &&
+           !_peak.compare_exchange_weak(p,u,std::memory_order_relaxed)) {}
+  }
+
   forceinline HeapChunk*
   SharedMemory::alloc(size_t s, size_t l) {
-    // To protect from exceptions from heap.ralloc()
-    Support::Lock guard(m());
-    while ((heap.hc != NULL) && (heap.hc->size < l)) {
-      heap.n_hc--;
-      HeapChunk* hc = heap.hc;
-      heap.hc = static_cast<HeapChunk*>(hc->next);
-      Gecode::heap.rfree(hc);
+    ThreadMemory& t = local();
+    if ((t.hc != NULL) && (t.hc->size >= l)) {
+      // Take heap chunk from cache of current thread
+      HeapChunk* hc = t.hc;
+      t.hc = static_cast<HeapChunk*>(hc->next);
+      t.n_hc--;
+      use(hc,true);
+      return hc;
     }
     HeapChunk* hc;
-    if (heap.hc == NULL) {
-      assert(heap.n_hc == 0);
-      hc = static_cast<HeapChunk*>(Gecode::heap.ralloc(s));
-      hc->size = s;
-    } else {
-      heap.n_hc--;
-      hc = heap.hc;
-      heap.hc = static_cast<HeapChunk*>(hc->next);
+    bool reuse;
+    {
+      // To protect from exceptions from heap.ralloc()
+      Support::Lock guard(m());
+      while ((heap.hc != NULL) && (heap.hc->size < l)) {
+        heap.n_hc--;
+        HeapChunk* f = heap.hc;
+        heap.hc = static_cast<HeapChunk*>(f->next);
+        Gecode::heap.rfree(f);
+      }
+      if (heap.hc == NULL) {
+        assert(heap.n_hc == 0);
+        hc = static_cast<HeapChunk*>(Gecode::heap.ralloc(s));
+        hc->size = s;
+        reuse = false;
+      } else {
+        heap.n_hc--;
+        hc = heap.hc;
+        heap.hc = static_cast<HeapChunk*>(hc->next);
+        reuse = true;
+      }
     }
+    use(hc,reuse);
     return hc;
   }
   forceinline void
   SharedMemory::free(HeapChunk* hc) {
-    Support::Lock guard(m());
-    if (heap.n_hc == MemoryConfig::n_hc_cache) {
-      Gecode::heap.rfree(hc);
-    } else {
-      heap.n_hc++;
-      hc->next = heap.hc; heap.hc = hc;
+    _used.fetch_sub(hc->size,std::memory_order_relaxed);
+    ThreadMemory& t = local();
+    if (t.n_hc == MemoryConfig::n_hc_thread_cache) {
+      // Hand over half of the thread's heap chunks to the shared cache
+      Support::Lock guard(m());
+      for (unsigned int i=MemoryConfig::n_hc_thread_cache/2; i--; ) {
+        HeapChunk* f = t.hc;
+        t.hc = static_cast<HeapChunk*>(f->next);
+        t.n_hc--;
+        if (heap.n_hc == MemoryConfig::n_hc_cache) {
+          Gecode::heap.rfree(f);
+        } else {
+          heap.n_hc++;
+          f->next = heap.hc; heap.hc = f;
+        }
+      }
     }
+    t.n_hc++;
+    hc->next = t.hc; t.hc = hc;
+  }
+
+  forceinline size_t
+  SharedMemory::peak(void) const {
+    return _peak.load(std::memory_order_relaxed);
+  }
+  forceinline unsigned long int
+  SharedMemory::chunk(void) const {
+    return _chunk.load(std::memory_order_relaxed);
+  }
+  forceinline unsigned long int
+  SharedMemory::chunk_reuse(void) const {
+    return _chunk_reuse.load(std::memory_order_relaxed);
   }
 
 
@@ -298,6 +409,11 @@ namespace Gecode { namespace Kernel {
     return &cur_hc->area[0];
   }
 
+  forceinline size_t
+  MemoryManager::allocated(void) const {
+    return requested - lsz;
+  }
+
   forceinline void
   MemoryManager::alloc_fill(SharedMemory& sm, size_t sz, bool first) {
     // Adjust current heap chunk size
@@ -113,9 +113,17 @@ namespace Gecode { namespace Search {
     const unsigned int c_d = 8;
     /// Create a clone during recomputation if distance is greater than \a a_d (adaptive distance)
     const unsigned int a_d = 2;
+    /// Whether the commit distance is adapted during search
+    const bool c_d_adaptive = false;
+    /// Maximal commit distance when adapted during search
+    const unsigned int c_d_max = 256;
 
     /// Minimal number of open nodes for stealing
     const unsigned int steal_limit = 3;
+    /// Whether parallel engines use randomized non-blocking work stealing
+    const bool ws = false;
+    /// Whether workers of parallel engines are bound to processing units
+    const bool affinity = false;
     /// Initial delay in milliseconds for all but first worker thread
     const unsigned int initial_delay = 5;
 
@@ -129,6 +137,10 @@ namespace Gecode { namespace Search {
 
     /// Depth limit for no-good generation during search
     const unsigned int nogoods_limit = 128;
+    /// Whether assets of a portfolio share no-goods
+    const bool nogoods_share = false;
+    /// Number of restarts for which no-goods are kept for exchange between assets
+    const unsigned int exchange = 64;
 
     /// Default port for CPProfiler
     const unsigned int cpprofiler_port = 6565U;
@@ -144,7 +156,7 @@ namespace Gecode { namespace Search {
    * \brief %Search engine statistics
    * \ingroup TaskModelSearch
    */
-  class Statistics : public StatusStatistics {
+  class Statistics : public StatusStatistics, public CloneStatistics {
   public:
     /// Number of failed nodes in search tree
     unsigned long int fail;
@@ -156,6 +168,14 @@ namespace Gecode { namespace Search {
     unsigned long int restart;
     /// Number of no-goods posted
     unsigned long int nogood;
+    /// Number of no-goods posted that have been shared by other assets
+    unsigned long int nogood_shared;
+    /// Number of attempts to steal work from another worker
+    unsigned long int steal_attempt;
+    /// Number of successful steals of work from another worker
+    unsigned long int steal_success;
+    /// Commit distance used last (maximum over all workers)
+    unsigned long int c_d;
     /// Initialize
     Statistics(void);
     /// Reset
@@ -726,7 +746,24 @@ namespace Gecode { namespace Search {
      *    the memory consumption considerably.
      *
      * Full copying corresponds to a maximal recomputation distance
-     * \a c_d of 1.
+     * \a c_d of 1. Pure recomputation corresponds to values for both
+     * \a c_d and \a a_d that exceed the depth of the search tree: then
+     * only the root space is stored and all other nodes are recomputed
+     * from it, so that memory consumption only depends on the choices
+     * stored for the current path. For models with large spaces and
+     * cheap propagation this can be considerably faster than copying.
+     * How many clones are created and how much memory they take is
+     * available from the engine's statistics.
+     *
+     * If \a c_d_adaptive is true, \a c_d is only used as initial commit
+     * distance for depth-first and branch-and-bound search. During
+     * search, the engine measures the average time for cloning
+     * \f$t_c\f$ and for propagation \f$t_p\f$ as well as the ratio of
+     * failed nodes \f$f\f$. It then chooses the commit distance
+     * \f$\sqrt{2t_c/(f t_p)}\f$ (but at most Config::c_d_max) that
+     * balances the cost of cloning against the cost of recomputation
+     * after failure. The distance finally used is available from the
+     * engine's statistics.
      *
      * All recomputation performed is based on batch recomputation: batch
      * recomputation performs propagation only once for an entire path
@@ -741,6 +778,41 @@ namespace Gecode { namespace Search {
      * \f$n \times m\f$ threads are chosen. If \f$-1 <n<0\f$,
      * \f$(1+n)\times m\f$ threads are chosen.
      *
+     * If \a ws is true, parallel engines use randomized work stealing: an
+     * idle worker starts looking for work at a randomly selected worker
+     * and never blocks on a busy worker but tries the next one instead.
+     * The number of steal attempts and successful steals are available
+     * from the engine's statistics.
+     *
+     * If \a nogoods_share is true, the restart-based assets of a
+     * portfolio share no-goods: at each restart an asset publishes its
+     * no-goods and posts the no-goods published by the other assets
+     * since its last restart (their number is available as
+     * \a nogood_shared from the engine's statistics). For best solution
+     * search, an asset is also constrained at each restart by the best
+     * solution any asset has found so far. No-goods are shared for
+     * branchers common to all assets: branchers created before the slave
+     * functions are executed (note that the default master function
+     * kills all branchers for a portfolio) and branchers that the slave
+     * functions create with the same types in the same order. The latter
+     * requires that these branchers branch on the same variables (they
+     * might differ in variable selection, tie-breaking, and random
+     * seeds). Sharing no-goods also requires that the slave functions of
+     * the assets do not post constraints other than branchers.
+     *
+     * Assets always share the accumulated failure count (AFC) of
+     * propagators as they are clones of the same space. Action and CHB
+     * information is shared if the IntAction, IntCHB, etc. objects are
+     * created before the assets (for example, as members of the space
+     * passed to the slave functions).
+     *
+     * If \a affinity is true, the workers of parallel engines are bound
+     * to processing units (worker \f$i\f$ to the \f$i\f$-th processing
+     * unit available). A worker then first tries to steal work from
+     * workers on the same NUMA node before asking workers on other nodes.
+     * As memory is allocated by the bound worker that uses it, its
+     * memory tends to be local to its node.
+     *
      * \ingroup TaskModelSearch
      */
     class Options {
@@ -753,6 +825,8 @@ namespace Gecode { namespace Search {
       unsigned int c_d;
       /// Create a clone during recomputation if distance is greater than \a a_d (adaptive distance)
       unsigned int a_d;
+      /// Whether the commit distance is adapted during search
+      bool c_d_adaptive;
       /// Discrepancy limit (for LDS)
       unsigned int d_l;
       /// Number of assets (engines) in a portfolio
@@ -761,6 +835,12 @@ namespace Gecode { namespace Search {
       unsigned int slice;
       /// Depth limit for extraction of no-goods
       unsigned int nogoods_limit;
+      /// Whether assets of a portfolio share no-goods
+      bool nogoods_share;
+      /// Whether parallel engines use randomized non-blocking work stealing
+      bool ws;
+      /// Whether workers of parallel engines are bound to processing units
+      bool affinity;
       /// Stop object for stopping search
       Stop* stop;
       /// Cutoff for restart-based search
@@ -893,6 +973,8 @@ namespace Gecode { namespace Search {
 
 namespace Gecode { namespace Search {
 
+  class Exchange;
+
   /**
    * \brief %Search engine implementation interface
    */
@@ -910,6 +992,8 @@ namespace Gecode { namespace Search {
     virtual void reset(Space* s);
     /// Return no-goods (the no-goods are empty)
     virtual NoGoods& nogoods(void);
+    /// Share no-goods with other engines through \a x (does nothing)
+    virtual void share(Exchange& x);
     /// Destructor
     virtual ~Engine(void);
   };
@@ -48,6 +48,10 @@ namespace Gecode { namespace Search {
   Engine::nogoods(void) {
     return NoGoods::eng;
   }
+  void
+  Engine::share(Exchange& x) {
+    (void) x;
+  }
 
 }}
 
@@ -0,0 +1,147 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Copyright:
+ *     Gecode contributors, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/search/exchange.hh>
+
+namespace Gecode { namespace Search {
+
+  ArchivedNoGoods::ArchivedNoGoods(Space& home, Archive& e, unsigned int bid)
+    : ds(heap) {
+    unsigned int n; e >> n;
+    for (unsigned int i=0U; i<n; i++) {
+      unsigned int a; e >> a;
+      bool r; e >> r;
+      unsigned int s; e >> s;
+      Archive c;
+      for (unsigned int j=0U; j<s; j++)
+        c << e.get();
+      // Only choices of shared branchers can be used
+      if ((s == 0U) || (c[0] >= bid))
+        break;
+      const Choice* ch;
+      try {
+        ch = home.choice(c);
+      } catch (SpaceNoBrancher&) {
+        break;
+      }
+      ds.push(Edge(ch,a,r));
+    }
+  }
+
+  void
+  ArchivedNoGoods::post(Space& home) const {
+    GECODE_ES_FAIL(NoGoodsProp::post(home,*this));
+  }
+
+  ArchivedNoGoods::~ArchivedNoGoods(void) {
+    while (!ds.empty())
+      ds.pop().dispose();
+  }
+
+
+  void
+  Exchange::put(unsigned int a, const NoGoods& ng) {
+    Archive c;
+    ng.archive(c);
+    // Do not publish empty no-goods
+    if ((c.size() == 0) || (c[0] == 0U))
+      return;
+    m.acquire();
+    unsigned long int i = n.load(std::memory_order_relaxed);
+    e[i % Config::exchange].asset = a;
+    e[i % Config::exchange].ng = c;
+    n.store(i+1UL, std::memory_order_release);
+    m.release();
+  }
+
+  unsigned long int
+  Exchange::get(unsigned int a, unsigned long int& s, Space& home) {
+    // Quick check without locking whether anything has been published
+    if (n.load(std::memory_order_acquire) == s)
+      return 0UL;
+    Region r;
+    Archive* c = r.alloc<Archive>(Config::exchange);
+    unsigned int k = 0U;
+    m.acquire();
+    unsigned long int l = n.load(std::memory_order_relaxed);
+    // Skip entries that have already been overwritten
+    if (l - s > Config::exchange)
+      s = l - Config::exchange;
+    for (; s < l; s++)
+      if (e[s % Config::exchange].asset != a)
+        c[k++] = e[s % Config::exchange].ng;
+    m.release();
+    unsigned long int n_nogood = 0UL;
+    for (unsigned int i=0U; i<k; i++) {
+      ArchivedNoGoods ang(home,c[i],bid);
+      ang.post(home);
+      n_nogood += ang.ng();
+    }
+    r.free<Archive>(c,Config::exchange);
+    return n_nogood;
+  }
+
+  void
+  Exchange::best(const Space& s) {
+    m.acquire();
+    if (b != NULL) {
+      b->constrain(s);
+      if (b->status() != SS_FAILED) {
+        // The published solution is at least as good
+        m.release();
+        return;
+      }
+      delete b;
+    }
+    b = s.clone();
+    n_b.store(n_b.load(std::memory_order_relaxed)+1UL,
+              std::memory_order_release);
+    m.release();
+  }
+
+  Space*
+  Exchange::best(unsigned long int& s) {
+    // Quick check without locking whether a new solution has been published
+    if (n_b.load(std::memory_order_acquire) == s)
+      return NULL;
+    m.acquire();
+    s = n_b.load(std::memory_order_relaxed);
+    Space* c = b->clone();
+    m.release();
+    return c;
+  }
+
+  Exchange::~Exchange(void) {
+    delete b;
+  }
+
+}}
+
+// STATISTICS: search-other
@@ -0,0 +1,168 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Copyright:
+ *     Gecode contributors, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#ifndef __GECODE_SEARCH_EXCHANGE_HH__
+#define __GECODE_SEARCH_EXCHANGE_HH__
+
+#include <gecode/search.hh>
+#include <gecode/search/nogoods.hh>
+
+#include <atomic>
+
+namespace Gecode { namespace Search {
+
+  /// No-goods restored from an archive created by NoGoods::archive
+  class GECODE_VTABLE_EXPORT ArchivedNoGoods : public NoGoods {
+    friend class NoGoodsProp;
+  public:
+    /// %Search tree edge restored from an archive
+    class Edge {
+    protected:
+      /// Choice
+      const Choice* _choice;
+      /// True number of alternatives
+      unsigned int _truealt;
+      /// Whether the alternative is rightmost
+      bool _rightmost;
+    public:
+      /// Default constructor
+      Edge(void);
+      /// Initialize with choice \a c, alternative \a a, and \a r
+      Edge(const Choice* c, unsigned int a, bool r);
+      /// Return choice
+      const Choice* choice(void) const;
+      /// Return true number for alternatives (excluding lao optimization)
+      unsigned int truealt(void) const;
+      /// Test whether current alternative is rightmost
+      bool rightmost(void) const;
+      /// Free memory for edge
+      void dispose(void);
+    };
+  protected:
+    /// Stack of edges
+    Support::DynamicStack<Edge,Heap> ds;
+  public:
+    /**
+     * \brief Initialize from archive \a e for space \a home
+     *
+     * Only choices created by branchers with an identity smaller
+     * than \a bid are used, the no-goods are truncated at the first
+     * edge with another choice.
+     */
+    GECODE_SEARCH_EXPORT
+    ArchivedNoGoods(Space& home, Archive& e, unsigned int bid);
+    /// Return no-good depth limit
+    unsigned int ngdl(void) const;
+    /// Post no-goods
+    GECODE_SEARCH_EXPORT
+    virtual void post(Space& home) const;
+    /// Destructor
+    GECODE_SEARCH_EXPORT
+    virtual ~ArchivedNoGoods(void);
+  };
+
+  /**
+   * \brief Buffer for exchanging information between assets of a portfolio
+   *
+   * The buffer keeps the no-goods of the last Config::exchange
+   * restarts of all assets. An asset publishes its no-goods at each
+   * restart and posts the no-goods published by the other assets
+   * since its last restart. If an asset restarts less often than the
+   * buffer is overwritten by the other assets, it misses no-goods.
+   *
+   * As no-goods are exchanged as archived choices, only choices of
+   * branchers common to all assets (that is, branchers with an identity
+   * smaller than \a bid, see CommonBranchers) can be exchanged.
+   *
+   * For best solution search, the buffer also keeps the best solution
+   * found by any asset. An asset publishes each solution it finds and
+   * constrains its master space by the best solution at each restart.
+   *
+   * Checking whether there is anything new does not require locking.
+   */
+  class GECODE_SEARCH_EXPORT Exchange : public HeapAllocated {
+  protected:
+    /// Entry of the buffer
+    class Entry {
+    public:
+      /// Asset that has published the no-goods
+      unsigned int asset;
+      /// The archived no-goods
+      Archive ng;
+    };
+    /// Identity of first brancher not shared by all assets
+    unsigned int bid;
+    /// Number of assets that have subscribed
+    unsigned int n_assets;
+    /// Number of entries published so far
+    std::atomic<unsigned long int> n;
+    /// Number of best solutions published so far
+    std::atomic<unsigned long int> n_b;
+    /// Best solution published so far (possibly NULL)
+    Space* b;
+    /// Mutex for accessing the entries and the best solution
+    Support::Mutex m;
+    /// The entries (used as ring buffer)
+    Entry e[Config::exchange];
+  public:
+    /// Initialize for branchers with identity smaller than \a bid
+    Exchange(unsigned int bid);
+    /// Subscribe and return identifier of new asset
+    unsigned int subscribe(void);
+    /// Publish no-goods \a ng by asset \a a
+    void put(unsigned int a, const NoGoods& ng);
+    /**
+     * \brief Post no-goods not yet seen by asset \a a into \a home
+     *
+     * The number \a s of entries seen by \a a is updated. Returns
+     * the number of no-goods posted.
+     */
+    unsigned long int get(unsigned int a, unsigned long int& s,
+                          Space& home);
+    /// Publish solution \a s (only kept if better than the best solution)
+    void best(const Space& s);
+    /**
+     * \brief Return clone of best solution if not yet seen
+     *
+     * The number \a s of best solutions seen is updated. Returns NULL
+     * if no new best solution has been published.
+     */
+    Space* best(unsigned long int& s);
+    /// Destructor
+    ~Exchange(void);
+  };
+
+}}
+
+#include <gecode/search/exchange.hpp>
+
+#endif
+
+// STATISTICS: search-other
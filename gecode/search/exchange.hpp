@@ -0,0 +1,84 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Copyright:
+ *     Gecode contributors, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+namespace Gecode { namespace Search {
+
+  /*
+   * Edges of archived no-goods
+   *
+   */
+  forceinline
+  ArchivedNoGoods::Edge::Edge(void) {}
+  forceinline
+  ArchivedNoGoods::Edge::Edge(const Choice* c, unsigned int a, bool r)
+    : _choice(c), _truealt(a), _rightmost(r) {}
+  forceinline const Choice*
+  ArchivedNoGoods::Edge::choice(void) const {
+    return _choice;
+  }
+  forceinline unsigned int
+  ArchivedNoGoods::Edge::truealt(void) const {
+    return _truealt;
+  }
+  forceinline bool
+  ArchivedNoGoods::Edge::rightmost(void) const {
+    return _rightmost;
+  }
+  forceinline void
+  ArchivedNoGoods::Edge::dispose(void) {
+    delete _choice;
+  }
+
+
+  forceinline unsigned int
+  ArchivedNoGoods::ngdl(void) const {
+    return static_cast<unsigned int>(ds.entries());
+  }
+
+
+  /*
+   * Exchange buffer
+   *
+   */
+  forceinline
+  Exchange::Exchange(unsigned int bid0)
+    : bid(bid0), n_assets(0U), n(0UL), n_b(0UL), b(NULL) {}
+
+  forceinline unsigned int
+  Exchange::subscribe(void) {
+    m.acquire();
+    unsigned int a = n_assets++;
+    m.release();
+    return a;
+  }
+
+}}
+
+// STATISTICS: search-other
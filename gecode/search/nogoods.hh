@@ -84,6 +84,9 @@ namespace Gecode { namespace Search {
     /// Post propagator for path \a p
     template<class Path>
     static ExecStatus post(Space& home, const Path& p);
+    /// Archive no-goods for path \a p into \a e
+    template<class Path>
+    static void archive(Archive& e, const Path& p);
     /// Delete propagator and return its size
     virtual size_t dispose(Space& home);
   };
@@ -171,6 +171,26 @@ namespace Gecode { namespace Search {
     return ES_OK;
   }
 
+  template<class Path>
+  forceinline void
+  NoGoodsProp::archive(Archive& e, const Path& p) {
+    int n = std::min(p.ds.entries(),static_cast<int>(p.ngdl()));
+
+    // Eliminate the alternatives which are not no-goods at the end
+    while ((n > 0) && (p.ds[n-1].truealt() == 0U))
+      n--;
+
+    e << n;
+    // Archive alternative information and choice for each edge
+    for (int i=0; i<n; i++) {
+      Archive c;
+      p.ds[i].choice()->archive(c);
+      e << p.ds[i].truealt() << p.ds[i].rightmost() << c.size();
+      for (int j=0; j<c.size(); j++)
+        e << c[j];
+    }
+  }
+
 }}
 
 // STATISTICS: search-other
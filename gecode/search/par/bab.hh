@@ -76,13 +76,22 @@ namespace Gecode { namespace Search { namespace Par {
       using Engine<Tracer>::Worker::start;
       using Engine<Tracer>::Worker::tracer;
       using Engine<Tracer>::Worker::stop;
+      using Engine<Tracer>::Worker::victim;
+      using Engine<Tracer>::Worker::local;
+      using Engine<Tracer>::Worker::bind;
+      using Engine<Tracer>::Worker::unbind;
+      using Engine<Tracer>::Worker::steal_attempt;
+      using Engine<Tracer>::Worker::steal_success;
+      using Engine<Tracer>::Worker::distance;
+      using Engine<Tracer>::Worker::copy;
+      using Engine<Tracer>::Worker::status;
       /// Number of entries not yet constrained to be better
       int mark;
       /// Best solution found so far
       Space* best;
     public:
-      /// Initialize for space \a s with engine \a e
-      Worker(Space* s, BAB& e);
+      /// Initialize for space \a s with engine \a e as \a i-th worker
+      Worker(Space* s, BAB& e, unsigned int i);
       /// Provide access to engine
       BAB& engine(void) const;
       /// Start execution of worker
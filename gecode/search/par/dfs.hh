@@ -76,8 +76,17 @@ namespace Gecode { namespace Search { namespace Par {
       using Engine<Tracer>::Worker::start;
       using Engine<Tracer>::Worker::tracer;
       using Engine<Tracer>::Worker::stop;
-      /// Initialize for space \a s with engine \a e
-      Worker(Space* s, DFS& e);
+      using Engine<Tracer>::Worker::victim;
+      using Engine<Tracer>::Worker::local;
+      using Engine<Tracer>::Worker::bind;
+      using Engine<Tracer>::Worker::unbind;
+      using Engine<Tracer>::Worker::steal_attempt;
+      using Engine<Tracer>::Worker::steal_success;
+      using Engine<Tracer>::Worker::distance;
+      using Engine<Tracer>::Worker::copy;
+      using Engine<Tracer>::Worker::status;
+      /// Initialize for space \a s with engine \a e as \a i-th worker
+      Worker(Space* s, DFS& e, unsigned int i);
       /// Provide access to engine
       DFS& engine(void) const;
       /// Start execution of worker
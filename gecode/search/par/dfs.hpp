@@ -53,8 +53,8 @@ namespace Gecode { namespace Search { namespace Par {
    */
   template<class Tracer>
   forceinline
-  DFS<Tracer>::Worker::Worker(Space* s, DFS& e)
-    : Engine<Tracer>::Worker(s,e) {}
+  DFS<Tracer>::Worker::Worker(Space* s, DFS& e, unsigned int i)
+    : Engine<Tracer>::Worker(s,e,i) {}
   template<class Tracer>
   forceinline
   DFS<Tracer>::DFS(Space* s, const Options& o)
@@ -65,10 +65,10 @@ namespace Gecode { namespace Search { namespace Par {
     _worker = static_cast<Worker**>
       (heap.ralloc(workers() * sizeof(Worker*)));
     // The first worker gets the entire search tree
-    _worker[0] = new Worker(s,*this);
+    _worker[0] = new Worker(s,*this,0U);
     // All other workers start with no work
     for (unsigned int i=1; i<workers(); i++)
-      _worker[i] = new Worker(NULL,*this);
+      _worker[i] = new Worker(NULL,*this,i);
     // Block all workers
     block();
     // Create and start threads
@@ -121,24 +121,52 @@ namespace Gecode { namespace Search { namespace Par {
   forceinline void
   DFS<Tracer>::Worker::find(void) {
     // Try to find new work (even if there is none)
-    for (unsigned int i=0U; i<engine().workers(); i++) {
-      unsigned long int r_d = 0ul;
-      typename Engine<Tracer>::Worker* wi = engine().worker(i);
-      if (Space* s = wi->steal(r_d,wi->tracer,tracer)) {
-        // Reset this guy
-        m.acquire();
-        idle = false;
-        // Not idle but also does not have the root of the tree
-        path.ngdl(0);
-        d = 0;
-        cur = s;
-        Statistics t = *this;
-        Search::Worker::reset(r_d);
-        (*this) += t;
-        m.release();
-        return;
+    unsigned int n = engine().workers();
+    // First worker to ask for work
+    unsigned int v = victim(n);
+    // Number of steal attempts
+    unsigned long int n_a = 0UL;
+    /*
+     * With affinity, workers on the same NUMA node are asked first.
+     *
+     * With randomized work stealing busy workers are skipped. As a
+     * busy worker keeps its mutex during propagation, a thief could
+     * fail to steal for a long time although there is work. Hence,
+     * if all steal attempts failed, a last round waits for busy workers.
+     */
+    unsigned int p_n = engine().opt().ws ? 3U : 2U;
+    for (unsigned int p = engine().opt().affinity ? 0U : 1U; p<p_n; p++) {
+      if ((p == 2U) && (n_a == 0UL))
+        break;
+      for (unsigned int i=0U; i<n; i++) {
+        unsigned long int r_d = 0ul;
+        typename Engine<Tracer>::Worker* wi = engine().worker((v+i) % n);
+        if (((p == 0U) && !local(*wi)) || !wi->stealable())
+          continue;
+        n_a++;
+        if (Space* s = wi->steal(r_d,wi->tracer,tracer,p == 2U)) {
+          // Reset this guy
+          m.acquire();
+          idle = false;
+          // Not idle but also does not have the root of the tree
+          path.ngdl(0);
+          d = 0;
+          cur = s;
+          Statistics t = *this;
+          Search::Worker::reset(r_d);
+          (*this) += t;
+          steal_attempt += n_a;
+          steal_success++;
+          m.release();
+          return;
+        }
       }
     }
+    if (n_a > 0UL) {
+      m.acquire();
+      steal_attempt += n_a;
+      m.release();
+    }
   }
 
   /*
@@ -174,6 +202,8 @@ namespace Gecode { namespace Search { namespace Par {
     // Peform initial delay, if not first worker
     if (this != engine().worker(0))
       Support::Thread::sleep(Config::initial_delay);
+    // Bind to processing unit, if requested
+    bind();
     // Okay, we are in business, start working
     while (true) {
       switch (engine().cmd()) {
@@ -186,6 +216,8 @@ namespace Gecode { namespace Search { namespace Par {
         engine().ack_terminate();
         // Wait until termination can proceed
         engine().wait_terminate();
+        // Pooled threads must not stay bound
+        unbind();
         // Thread will be terminated by returning from run
         return;
       case C_RESET:
@@ -224,7 +256,7 @@ namespace Gecode { namespace Search { namespace Par {
                 }
               }
               unsigned int nid = tracer.nid();
-              switch (cur->status(*this)) {
+              switch (status(*cur,engine().opt())) {
               case SS_FAILED:
                 if (tracer) {
                   SearchTracer::NodeInfo ni(SearchTracer::NodeType::FAILED,
@@ -246,7 +278,7 @@ namespace Gecode { namespace Search { namespace Par {
                   }
                   // Deletes all pending branchers
                   (void) cur->choice();
-                  Space* s = cur->clone();
+                  Space* s = cur->clone(*this);
                   delete cur;
                   cur = NULL;
                   path.next();
@@ -257,8 +289,8 @@ namespace Gecode { namespace Search { namespace Par {
               case SS_BRANCH:
                 {
                   Space* c;
-                  if ((d == 0) || (d >= engine().opt().c_d)) {
-                    c = cur->clone();
+                  if ((d == 0) || (d >= distance(engine().opt()))) {
+                    c = copy(*cur,engine().opt());
                     d = 1;
                   } else {
                     c = NULL;
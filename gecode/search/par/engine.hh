@@ -63,11 +63,33 @@ namespace Gecode { namespace Search { namespace Par {
       unsigned int d;
       /// Whether the worker is idle
       bool idle;
+      /// Random number generator for selecting victims for stealing
+      Support::RandomGenerator rnd;
+      /// Processing unit of the worker (if bound)
+      unsigned int pu;
+      /// NUMA node of the worker's processing unit
+      unsigned int numa;
     public:
-      /// Initialize for space \a s with engine \a e
-      Worker(Space* s, Engine& e);
-      /// Hand over some work (NULL if no work available)
-      Space* steal(unsigned long int& d, Tracer& myt, Tracer& ot);
+      /// Initialize for space \a s with engine \a e as \a i-th worker
+      Worker(Space* s, Engine& e, unsigned int i);
+      /// Bind worker to its processing unit (if requested)
+      void bind(void);
+      /// Release worker from its processing unit (if bound)
+      void unbind(void);
+      /// Test whether worker \a w is on the same NUMA node
+      bool local(const Worker& w) const;
+      /// Make a quick check whether the worker might have work to steal
+      bool stealable(void) const;
+      /**
+       * \brief Hand over some work (NULL if no work available)
+       *
+       * With randomized work stealing, a busy worker is skipped unless
+       * \a block is true.
+       */
+      Space* steal(unsigned long int& d, Tracer& myt, Tracer& ot,
+                   bool block=false);
+      /// Return first victim for stealing among \a n workers
+      unsigned int victim(unsigned int n);
       /// Return statistics
       Statistics statistics(void);
       /// Provide access to engine
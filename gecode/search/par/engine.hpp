@@ -92,10 +92,11 @@ namespace Gecode { namespace Search { namespace Par {
    */
   template<class Tracer>
   forceinline
-  Engine<Tracer>::Worker::Worker(Space* s, Engine& e)
+  Engine<Tracer>::Worker::Worker(Space* s, Engine& e, unsigned int i)
     : tracer(e.opt().tracer), _engine(e),
       path(s == NULL ? 0 : e.opt().nogoods_limit), d(0),
-      idle(false) {
+      idle(false), rnd(Support::hwrnd()), pu(i),
+      numa(e.opt().affinity ? Support::Thread::node(i) : 0U) {
     tracer.worker();
     if (s != NULL) {
       if (s->status(*this) == SS_FAILED) {
@@ -162,7 +163,6 @@ namespace Gecode { namespace Search { namespace Par {
   forceinline void
   Engine<Tracer>::busy(void) {
     m_search.acquire();
-    assert(n_busy > 0);
     n_busy++;
     m_search.release();
   }
@@ -260,10 +260,43 @@ namespace Gecode { namespace Search { namespace Par {
   /*
    * Worker: finding and stealing working
    */
+  /*
+   * Worker: placement
+   */
+  template<class Tracer>
+  forceinline void
+  Engine<Tracer>::Worker::bind(void) {
+    if (engine().opt().affinity)
+      (void) Support::Thread::bind(pu);
+  }
+  template<class Tracer>
+  forceinline void
+  Engine<Tracer>::Worker::unbind(void) {
+    if (engine().opt().affinity)
+      Support::Thread::unbind();
+  }
+  template<class Tracer>
+  forceinline bool
+  Engine<Tracer>::Worker::local(const Worker& w) const {
+    return numa == w.numa;
+  }
+
+  template<class Tracer>
+  forceinline bool
+  Engine<Tracer>::Worker::stealable(void) const {
+    return path.steal();
+  }
+
+  template<class Tracer>
+  forceinline unsigned int
+  Engine<Tracer>::Worker::victim(unsigned int n) {
+    return engine().opt().ws ? rnd(n) : 0U;
+  }
+
   template<class Tracer>
   forceinline Space*
   Engine<Tracer>::Worker::steal(unsigned long int& d, 
-                                Tracer& myt, Tracer& ot) {
+                                Tracer& myt, Tracer& ot, bool block) {
     /*
      * Make a quick check whether the worker might have work
      *
@@ -272,12 +305,29 @@ namespace Gecode { namespace Search { namespace Par {
      */
     if (!path.steal())
       return NULL;
-    m.acquire();
+    /*
+     * Tell that there will be one more busy worker before stealing:
+     * otherwise the victim might become idle after the work has been
+     * stolen but before the thief is counted as busy, and the engine
+     * would wrongly assume that the search is finished.
+     */
+    engine().busy();
+    /*
+     * With randomized work stealing a thief does not wait for a busy
+     * victim: it rather moves on and tries the next worker.
+     */
+    if (engine().opt().ws && !block) {
+      if (!m.tryacquire()) {
+        engine().idle();
+        return NULL;
+      }
+    } else {
+      m.acquire();
+    }
     Space* s = path.steal(*this,d,myt,ot);
     m.release();
-    // Tell that there will be one more busy worker
-    if (s != NULL)
-      engine().busy();
+    if (s == NULL)
+      engine().idle();
     return s;
   }
 
@@ -156,6 +156,8 @@ namespace Gecode { namespace Search { namespace Par {
                  Tracer& myt, Tracer& ot);
     /// Post no-goods
     void virtual post(Space& home) const;
+    /// Archive no-goods into \a e
+    virtual void archive(Archive& e) const;
   };
 
 }}}
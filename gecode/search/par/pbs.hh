@@ -35,6 +35,7 @@
 #define __GECODE_SEARCH_PAR_PBS_HH__
 
 #include <gecode/search.hh>
+#include <gecode/search/exchange.hh>
 
 namespace Gecode { namespace Search { namespace Par {
 
@@ -158,6 +159,8 @@ namespace Gecode { namespace Search { namespace Par {
     unsigned int n_busy;
     /// Signal that number of busy slaves becomes zero
     Support::Event idle;
+    /// Exchange for sharing no-goods between slaves (possibly NULL)
+    Exchange* x;
     /// Process report from slave, return false if solution was ignored
     bool report(Slave<Collect>* slave, Space* s);
     /**
@@ -169,8 +172,9 @@ namespace Gecode { namespace Search { namespace Par {
      *  - the slaves n_active..n_slaves-1 have exhausted their search space.
      */
   public:
-    /// Initialize
-    PBS(Engine** s, Stop** so, unsigned int n, const Statistics& stat);
+    /// Initialize with exchange \a x
+    PBS(Engine** s, Stop** so, unsigned int n, const Statistics& stat,
+        Exchange* x);
     /// Return next solution (NULL, if none exists or search has been stopped)
     virtual Space* next(void);
     /// Return statistics
@@ -153,10 +153,10 @@ namespace Gecode { namespace Search { namespace Par {
   template<class Collect>
   forceinline
   PBS<Collect>::PBS(Engine** engines, Stop** stops, unsigned int n,
-                    const Statistics& stat0)
+                    const Statistics& stat0, Exchange* x0)
     : stat(stat0), slaves(heap.alloc<Slave<Collect>*>(n)),
       n_slaves(n), n_active(n),
-      slave_stop(false), tostop(false), n_busy(0) {
+      slave_stop(false), tostop(false), n_busy(0), x(x0) {
     // Initialize slaves
     for (unsigned int i=0U; i<n_slaves; i++) {
       slaves[i] = new Slave<Collect>(this,engines[i],stops[i]);
@@ -284,6 +284,7 @@ namespace Gecode { namespace Search { namespace Par {
   PBS<Collect>::~PBS(void) {
     assert(n_busy == 0);
     heap.free<Slave<Collect>*>(slaves,n_slaves);
+    delete x;
   }
 
 }}}
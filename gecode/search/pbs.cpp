@@ -32,6 +32,70 @@
  */
 
 #include <gecode/search/seq/pbs.hh>
+#include <gecode/search/exchange.hh>
+
+#include <typeinfo>
+
+namespace Gecode { namespace Search {
+
+  CommonBranchers::CommonBranchers(const Space& master)
+    : bid(master.brancherid()), sid(bid), n_assets(0U), n(0U),
+      ids(NULL), types(NULL) {}
+
+  void
+  CommonBranchers::add(const Space& s) {
+    // Branchers created by the slave function
+    unsigned int m = 0U;
+    for (Branchers bs(s,BrancherGroup::all); bs(); ++bs)
+      if (bs.brancher().id() >= sid)
+        m++;
+    if (n_assets++ == 0U) {
+      // First asset: record identities and types
+      n = m;
+      ids = heap.alloc<unsigned int>(n);
+      types = heap.alloc<size_t>(n);
+      unsigned int i = 0U;
+      for (Branchers bs(s,BrancherGroup::all); bs(); ++bs)
+        if (bs.brancher().id() >= sid) {
+          ids[i] = bs.brancher().id();
+          types[i] = typeid(bs.brancher()).hash_code();
+          i++;
+        }
+      bid = s.brancherid();
+    } else {
+      // Find first brancher that differs from the first asset
+      unsigned int i = 0U;
+      for (Branchers bs(s,BrancherGroup::all); bs(); ++bs)
+        if (bs.brancher().id() >= sid) {
+          if ((i >= n) || (ids[i] != bs.brancher().id()) ||
+              (types[i] != typeid(bs.brancher()).hash_code()))
+            break;
+          i++;
+        }
+      if (i < n)
+        bid = std::min(bid,ids[i]);
+      bid = std::min(bid,s.brancherid());
+    }
+  }
+
+  CommonBranchers::~CommonBranchers(void) {
+    heap.free<unsigned int>(ids,n);
+    heap.free<size_t>(types,n);
+  }
+
+  /// Create exchange for sharing no-goods between slaves (if requested)
+  forceinline Exchange*
+  share(Engine** slaves, unsigned int n_slaves,
+        const Search::Options& opt, unsigned int bid) {
+    if (!opt.nogoods_share)
+      return NULL;
+    Exchange* x = new Exchange(bid);
+    for (unsigned int i=0U; i<n_slaves; i++)
+      slaves[i]->share(*x);
+    return x;
+  }
+
+}}
 
 namespace Gecode { namespace Search { namespace Seq {
 
@@ -42,11 +106,13 @@ namespace Gecode { namespace Search { namespace Seq {
 
   Engine*
   pbsengine(Engine** slaves, Stop** stops, unsigned int n_slaves,
-            const Statistics& stat, const Search::Options& opt, bool best) {
+            const Statistics& stat, const Search::Options& opt, bool best,
+            unsigned int bid) {
+    Exchange* x = share(slaves,n_slaves,opt,bid);
     if (best)
-      return new PBS<true>(slaves,stops,n_slaves,stat,opt);
+      return new PBS<true>(slaves,stops,n_slaves,stat,opt,x);
     else
-      return new PBS<false>(slaves,stops,n_slaves,stat,opt);
+      return new PBS<false>(slaves,stops,n_slaves,stat,opt,x);
   }
 
 }}}
@@ -64,11 +130,13 @@ namespace Gecode { namespace Search { namespace Par {
 
   Engine*
   pbsengine(Engine** slaves, Stop** stops, unsigned int n_slaves,
-         const Statistics& stat, bool best) {
+            const Statistics& stat, const Search::Options& opt, bool best,
+            unsigned int bid) {
+    Exchange* x = share(slaves,n_slaves,opt,bid);
     if (best)
-      return new PBS<CollectBest>(slaves,stops,n_slaves,stat);
+      return new PBS<CollectBest>(slaves,stops,n_slaves,stat,x);
     else
-      return new PBS<CollectAll>(slaves,stops,n_slaves,stat);
+      return new PBS<CollectAll>(slaves,stops,n_slaves,stat,x);
   }
 
 }}}
@@ -68,10 +68,16 @@ namespace Gecode { namespace Search { namespace Seq {
   GECODE_SEARCH_EXPORT Stop*
   pbsstop(Stop* so);
 
-  /// Create sequential portfolio engine
+  /**
+   * \brief Create sequential portfolio engine
+   *
+   * Only choices of branchers with identity less than \a bid are
+   * shared as no-goods between slaves.
+   */
   GECODE_SEARCH_EXPORT Engine*
   pbsengine(Engine** slaves, Stop** stops, unsigned int n_slaves,
-            const Statistics& stat, const Search::Options& opt, bool best);
+            const Statistics& stat, const Search::Options& opt, bool best,
+            unsigned int bid);
 
 }}}
 
@@ -81,15 +87,61 @@ namespace Gecode { namespace Search { namespace Par {
   GECODE_SEARCH_EXPORT Stop*
   pbsstop(Stop* so);
 
-  /// Create parallel portfolio engine
+  /**
+   * \brief Create parallel portfolio engine
+   *
+   * Only choices of branchers with identity less than \a bid are
+   * shared as no-goods between slaves.
+   */
   GECODE_SEARCH_EXPORT Engine*
   pbsengine(Engine** slaves, Stop** stops, unsigned int n_slaves,
-            const Statistics& stat, bool best);
+            const Statistics& stat, const Search::Options& opt, bool best,
+            unsigned int bid);
 
 }}}
 
 namespace Gecode { namespace Search {
 
+  /**
+   * \brief Branchers that all assets of a portfolio have in common
+   *
+   * Choices (and hence no-goods) of a brancher can be shared between
+   * assets only if all assets have a brancher with the same identity
+   * and of the same type. Branchers created before the slave functions
+   * are executed are common to all assets. Branchers created by the
+   * slave functions are considered common as long as all assets create
+   * branchers of the same types in the same order.
+   */
+  class GECODE_SEARCH_EXPORT CommonBranchers {
+  protected:
+    /// Identity of first brancher not common to all assets
+    unsigned int bid;
+    /// Identity of first brancher created by the slave functions
+    unsigned int sid;
+    /// Number of assets added
+    unsigned int n_assets;
+    /// Number of branchers created by the slave function of the first asset
+    unsigned int n;
+    /// Identities of branchers created by the slave function of the first asset
+    unsigned int* ids;
+    /// Types of branchers created by the slave function of the first asset
+    size_t* types;
+  public:
+    /// Initialize with the branchers of \a master
+    CommonBranchers(const Space& master);
+    /// Add the branchers of asset \a s (after its slave function)
+    void add(const Space& s);
+    /// Return identity of first brancher not common to all assets
+    unsigned int id(void) const;
+    /// Destructor
+    ~CommonBranchers(void);
+  };
+
+  forceinline unsigned int
+  CommonBranchers::id(void) const {
+    return bid;
+  }
+
   template<class T, template<class> class E>
   Engine*
   pbsseq(T* master, const Search::Statistics& stat, Options& opt) {
@@ -107,15 +159,18 @@ namespace Gecode { namespace Search {
     WrapTraceRecorder::engine(opt.tracer,
                               SearchTracer::EngineType::PBS, n_slaves);
 
+    CommonBranchers cb(*master);
+
     for (unsigned int i=0U; i<n_slaves; i++) {
       opt.stop = stops[i] = Seq::pbsstop(stop);
       Space* slave = (i == n_slaves-1) ?
         master : master->clone();
       (void) slave->slave(i);
+      cb.add(*slave);
       slaves[i] = build<T,E>(slave,opt);
     }
 
-    return Seq::pbsengine(slaves,stops,n_slaves,stat,opt,E<T>::best);
+    return Seq::pbsengine(slaves,stops,n_slaves,stat,opt,E<T>::best,cb.id());
   }
 
   template<class T, template<class> class E>
@@ -131,6 +186,8 @@ namespace Gecode { namespace Search {
     WrapTraceRecorder::engine(opt.tracer,
                               SearchTracer::EngineType::PBS, n_slaves);
 
+    CommonBranchers cb(*master);
+
     for (int i=0; i<n_slaves; i++) {
       // Re-configure slave options
       stops[i] = Seq::pbsstop(sebs[i]->options().stop);
@@ -139,11 +196,12 @@ namespace Gecode { namespace Search {
       Space* slave = (i == n_slaves-1) ?
         master : master->clone();
       (void) slave->slave(i);
+      cb.add(*slave);
       slaves[i] = (*sebs[i])(slave);
       delete sebs[i];
     }
 
-    return Seq::pbsengine(slaves,stops,n_slaves,stat,opt,best);
+    return Seq::pbsengine(slaves,stops,n_slaves,stat,opt,best,cb.id());
   }
 
 #ifdef GECODE_HAS_THREADS
@@ -166,15 +224,18 @@ namespace Gecode { namespace Search {
     Engine** slaves = r.alloc<Engine*>(n_slaves);
     Stop** stops = r.alloc<Stop*>(n_slaves);
 
+    CommonBranchers cb(*master);
+
     for (unsigned int i=0U; i<n_slaves; i++) {
       opt.stop = stops[i] = Par::pbsstop(stop);
       Space* slave = (i == n_slaves-1) ?
         master : master->clone();
       (void) slave->slave(i);
+      cb.add(*slave);
       slaves[i] = build<T,E>(slave,opt);
     }
 
-    return Par::pbsengine(slaves,stops,n_slaves,stat,E<T>::best);
+    return Par::pbsengine(slaves,stops,n_slaves,stat,opt,E<T>::best,cb.id());
   }
 
   template<class T, template<class> class E>
@@ -193,6 +254,8 @@ namespace Gecode { namespace Search {
     Engine** slaves = r.alloc<Engine*>(n_slaves);
     Stop** stops = r.alloc<Stop*>(n_slaves);
 
+    CommonBranchers cb(*master);
+
     for (int i=0; i<n_slaves; i++) {
       // Re-configure slave options
       stops[i] = Par::pbsstop(sebs[i]->options().stop);
@@ -201,6 +264,7 @@ namespace Gecode { namespace Search {
       Space* slave = (i == n_slaves-1) ?
         master : master->clone();
       (void) slave->slave(i);
+      cb.add(*slave);
       slaves[i] = (*sebs[i])(slave);
       delete sebs[i];
     }
@@ -208,7 +272,7 @@ namespace Gecode { namespace Search {
     for (int i=n_slaves; i<sebs.size(); i++)
       delete sebs[i];
 
-    return Par::pbsengine(slaves,stops,n_slaves,stat,best);
+    return Par::pbsengine(slaves,stops,n_slaves,stat,opt,best,cb.id());
   }
 
 #endif
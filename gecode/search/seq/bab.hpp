@@ -95,7 +95,7 @@ namespace Gecode { namespace Search { namespace Seq {
         ei.init(tracer.wid(), top.nid(), top.truealt(), *cur, *top.choice());
       }
       unsigned int nid = tracer.nid();
-      switch (cur->status(*this)) {
+      switch (status(*cur,opt)) {
       case SS_FAILED:
         if (tracer) {
           SearchTracer::NodeInfo ni(SearchTracer::NodeType::FAILED,
@@ -126,8 +126,8 @@ namespace Gecode { namespace Search { namespace Seq {
       case SS_BRANCH:
         {
           Space* c;
-          if ((d == 0) || (d >= opt.c_d)) {
-            c = cur->clone();
+          if ((d == 0) || (d >= distance(opt))) {
+            c = copy(*cur,opt);
             d = 1;
           } else {
             c = NULL;
@@ -145,6 +145,8 @@ namespace Gecode { namespace Search { namespace Seq {
     void reset(void);
     /// Post no-goods
     virtual void post(Space& home) const;
+    /// Archive no-goods into \a e
+    virtual void archive(Archive& e) const;
   };
 
 }}}
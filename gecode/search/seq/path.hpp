@@ -246,7 +246,7 @@ namespace Gecode { namespace Search { namespace Seq {
     // New distance, if no adaptive recomputation
     d = static_cast<unsigned int>(n - l);
 
-    Space* s = ds[l].space()->clone(); // Last clone
+    Space* s = ds[l].space()->clone(stat); // Last clone
 
     if (d < a_d) {
       // No adaptive recomputation
@@ -276,7 +276,7 @@ namespace Gecode { namespace Search { namespace Seq {
           unwind(i,t);
           return NULL;
         }
-        ds[i].space(s->clone());
+        ds[i].space(s->clone(stat));
         d = static_cast<unsigned int>(n-i);
       }
       // Finally do the remaining commits
@@ -333,10 +333,10 @@ namespace Gecode { namespace Search { namespace Seq {
       // It is important to replace the space on the stack with the
       // copy: a copy might be much smaller due to flushed caches
       // of propagators
-      Space* c = s->clone();
+      Space* c = s->clone(stat);
       ds[l].space(c);
     } else {
-      s = s->clone();
+      s = s->clone(stat);
     }
 
     if (d < a_d) {
@@ -370,7 +370,7 @@ namespace Gecode { namespace Search { namespace Seq {
           unwind(i,t);
           return NULL;
         }
-        ds[i].space(s->clone());
+        ds[i].space(s->clone(stat));
         d = static_cast<unsigned int>(n-i);
       }
       // Finally do the remaining commits
@@ -386,6 +386,12 @@ namespace Gecode { namespace Search { namespace Seq {
     GECODE_ES_FAIL(NoGoodsProp::post(home,*this));
   }
 
+  template<class Tracer>
+  void
+  Path<Tracer>::archive(Archive& e) const {
+    NoGoodsProp::archive(e,*this);
+  }
+
 }}}
 
 // STATISTICS: search-seq
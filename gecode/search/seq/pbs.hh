@@ -35,6 +35,7 @@
 #define __GECODE_SEARCH_SEQ_PBS_HH__
 
 #include <gecode/search.hh>
+#include <gecode/search/exchange.hh>
 
 namespace Gecode { namespace Search { namespace Seq {
 
@@ -105,10 +106,12 @@ namespace Gecode { namespace Search { namespace Seq {
     unsigned int cur;
     /// Whether a slave has been stopped
     bool slave_stop;
+    /// Exchange for sharing no-goods between slaves (possibly NULL)
+    Exchange* x;
   public:
-    /// Initialize
+    /// Initialize with exchange \a x
     PBS(Engine** slaves, Stop** stops, unsigned int n,
-        const Statistics& stat, const Search::Options& opt);
+        const Statistics& stat, const Search::Options& opt, Exchange* x);
     /// Return next solution (NULL, if none exists or search has been stopped)
     virtual Space* next(void);
     /// Return statistics
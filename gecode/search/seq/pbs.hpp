@@ -76,10 +76,10 @@ namespace Gecode { namespace Search { namespace Seq {
   forceinline
   PBS<best>::PBS(Engine** e, Stop** s, unsigned int n,
                  const Statistics& stat0,
-                 const Search::Options& opt)
+                 const Search::Options& opt, Exchange* x0)
     : stat(stat0), slice(opt.slice),
       slaves(heap.alloc<Slave>(n)), n_slaves(n), cur(0),
-      slave_stop(false) {
+      slave_stop(false), x(x0) {
     ssi.done = false;
     ssi.l = opt.slice;
 
@@ -162,6 +162,7 @@ namespace Gecode { namespace Search { namespace Seq {
       slaves[i].~Slave();
     // Note that n_slaves might be different now!
     heap.rfree(slaves);
+    delete x;
   }
 
 }}}
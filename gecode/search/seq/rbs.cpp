@@ -33,6 +33,7 @@
 
 
 #include <gecode/search/seq/rbs.hh>
+#include <gecode/search/exchange.hh>
 
 namespace Gecode { namespace Search { namespace Seq {
 
@@ -52,6 +53,28 @@ namespace Gecode { namespace Search { namespace Seq {
     return false;
   }
 
+  void
+  RBS::share(Exchange& x0) {
+    x = &x0;
+    x_a = x->subscribe();
+  }
+
+  void
+  RBS::exchange(NoGoods& ng) {
+    if (x == NULL)
+      return;
+    x->put(x_a,ng);
+    unsigned long int n = x->get(x_a,x_s,*master);
+    stop->m_stat.nogood += n;
+    stop->m_stat.nogood_shared += n;
+    // Constrain by best solution found by any asset
+    if (best)
+      if (Space* b = x->best(x_b)) {
+        master->constrain(*b);
+        delete b;
+      }
+  }
+
   Space*
   RBS::next(void) {
     if (restart) {
@@ -63,6 +86,7 @@ namespace Gecode { namespace Search { namespace Seq {
       MetaInfo mi(stop->m_stat.restart,sslr,e->statistics().fail,last,ng);
       bool r = master->master(mi);
       stop->m_stat.nogood += ng.ng();
+      exchange(ng);
       if (master->status(stop->m_stat) == SS_FAILED) {
         stop->update(e->statistics());
         delete master;
@@ -86,6 +110,8 @@ namespace Gecode { namespace Search { namespace Seq {
         restart = true;
         delete last;
         last = n->clone();
+        if (best && (x != NULL))
+          x->best(*last);
         return n;
       } else if ( (!complete && !e->stopped()) ||
                   (e->stopped() && stop->enginestopped()) ) {
@@ -94,9 +120,11 @@ namespace Gecode { namespace Search { namespace Seq {
         sslr = 0;
         NoGoods& ng = e->nogoods();
         ng.ng(0);
-        MetaInfo mi(stop->m_stat.restart,sslr,e->statistics().fail,last,ng);
+        MetaInfo mi(stop->m_stat.restart,sslr,e->statistics().fail,last,ng,
+                    !e->stopped());
         (void) master->master(mi);
         stop->m_stat.nogood += ng.ng();
+        exchange(ng);
         long unsigned int nl = ++(*co);
         stop->limit(e->statistics(),nl);
         if (master->status(stop->m_stat) == SS_FAILED)
@@ -91,6 +91,16 @@ namespace Gecode { namespace Search { namespace Seq {
     bool restart;
     /// Whether the engine performs best solution search
     bool best;
+    /// Exchange for sharing no-goods with other assets (possibly NULL)
+    Exchange* x;
+    /// Identifier of this engine as asset of the exchange
+    unsigned int x_a;
+    /// Number of entries of the exchange already seen
+    unsigned long int x_s;
+    /// Number of best solutions of the exchange already seen
+    unsigned long int x_b;
+    /// Share no-goods \a ng and best solutions through exchange
+    void exchange(NoGoods& ng);
   public:
     /// Constructor
     RBS(Space* s, RestartStop* stop0, Engine* e0,
@@ -103,6 +113,8 @@ namespace Gecode { namespace Search { namespace Seq {
     virtual bool stopped(void) const;
     /// Constrain future solutions to be better than \a b
     virtual void constrain(const Space& b);
+    /// Share no-goods and best solutions with other engines through \a x
+    virtual void share(Exchange& x);
     /// Destructor
     virtual ~RBS(void);
   };
@@ -67,7 +67,8 @@ namespace Gecode { namespace Search { namespace Seq {
            bool best0)
     : e(e0), master(s), last(NULL), co(opt.cutoff), stop(stop0),
       sslr(0),
-      complete(true), restart(false), best(best0) {
+      complete(true), restart(false), best(best0),
+      x(NULL), x_a(0U), x_s(0UL), x_b(0UL) {
     stop->limit(stat,(*co)());
   }
 
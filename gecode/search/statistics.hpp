@@ -38,22 +38,30 @@ namespace Gecode { namespace Search {
   forceinline void
   Statistics::reset(void) {
     StatusStatistics::reset();
-    fail=0; node=0; depth=0; restart=0; nogood=0;
+    CloneStatistics::reset();
+    fail=0; node=0; depth=0; restart=0; nogood=0; nogood_shared=0;
+    steal_attempt=0; steal_success=0; c_d=0;
   }
 
   forceinline
   Statistics::Statistics(void)
     : fail(0), node(0), depth(0),
-      restart(0), nogood(0) {}
+      restart(0), nogood(0), nogood_shared(0),
+      steal_attempt(0), steal_success(0), c_d(0) {}
 
   forceinline Statistics&
   Statistics::operator +=(const Statistics& s) {
     (void) StatusStatistics::operator +=(s);
+    (void) CloneStatistics::operator +=(s);
     fail += s.fail;
     node += s.node;
     depth = std::max(depth,s.depth);
     restart += s.restart;
     nogood += s.nogood;
+    nogood_shared += s.nogood_shared;
+    steal_attempt += s.steal_attempt;
+    steal_success += s.steal_success;
+    c_d = std::max(c_d,s.c_d);
     return *this;
   }
 
@@ -34,6 +34,8 @@
 #ifndef __GECODE_SEARCH_WORKER_HH__
 #define __GECODE_SEARCH_WORKER_HH__
 
+#include <cmath>
+
 #include <gecode/search.hh>
 
 namespace Gecode { namespace Search {
@@ -47,6 +49,21 @@ namespace Gecode { namespace Search {
     bool _stopped;
     /// Depth of root node (for work stealing)
     unsigned long int root_depth;
+    /// \name Information for adapting the commit distance
+    //@{
+    /// Current commit distance (zero if not yet initialized)
+    unsigned int _c_d;
+    /// Time spent for cloning (in milliseconds)
+    double t_clone;
+    /// Number of clones measured
+    unsigned long int n_clone;
+    /// Time spent for propagation (in milliseconds)
+    double t_status;
+    /// Number of propagations measured
+    unsigned long int n_status;
+    /// Recompute commit distance from the collected information
+    void adapt(void);
+    //@}
   public:
     /// Initialize
     Worker(void);
@@ -62,13 +79,20 @@ namespace Gecode { namespace Search {
     void stack_depth(unsigned long int d);
     /// Return steal depth
     unsigned long int steal_depth(unsigned long int d) const;
+    /// Return commit distance according to options \a o
+    unsigned int distance(const Options& o);
+    /// Clone space \a s (measure time if requested by options \a o)
+    Space* copy(const Space& s, const Options& o);
+    /// Propagate space \a s (measure time if requested by options \a o)
+    SpaceStatus status(Space& s, const Options& o);
   };
 
 
 
   forceinline
   Worker::Worker(void)
-    : _stopped(false), root_depth(0) {}
+    : _stopped(false), root_depth(0),
+      _c_d(0), t_clone(0.0), n_clone(0UL), t_status(0.0), n_status(0UL) {}
 
   forceinline void
   Worker::start(void) {
@@ -107,6 +131,57 @@ namespace Gecode { namespace Search {
     return root_depth + d;
   }
 
+  forceinline void
+  Worker::adapt(void) {
+    // Wait for sufficient information
+    if ((n_clone < 16UL) || (n_status < 16UL) || (fail == 0UL) ||
+        (t_status <= 0.0))
+      return;
+    double t_c = t_clone / n_clone;
+    double t_p = t_status / n_status;
+    double f = static_cast<double>(fail) / n_status;
+    double d = std::sqrt(2.0 * t_c / (f * t_p));
+    if (d < 1.0)
+      _c_d = 1U;
+    else if (d > static_cast<double>(Config::c_d_max))
+      _c_d = Config::c_d_max;
+    else
+      _c_d = static_cast<unsigned int>(d + 0.5);
+  }
+
+  forceinline unsigned int
+  Worker::distance(const Options& o) {
+    if (!o.c_d_adaptive) {
+      c_d = o.c_d;
+      return o.c_d;
+    }
+    if (_c_d == 0U)
+      _c_d = std::max(o.c_d,1U);
+    c_d = _c_d;
+    return _c_d;
+  }
+
+  forceinline Space*
+  Worker::copy(const Space& s, const Options& o) {
+    if (!o.c_d_adaptive)
+      return s.clone(*this);
+    Support::Timer t; t.start();
+    Space* c = s.clone(*this);
+    t_clone += t.stop(); n_clone++;
+    adapt();
+    return c;
+  }
+
+  forceinline SpaceStatus
+  Worker::status(Space& s, const Options& o) {
+    if (!o.c_d_adaptive)
+      return s.status(*this);
+    Support::Timer t; t.start();
+    SpaceStatus ss = s.status(*this);
+    t_status += t.stop(); n_status++;
+    return ss;
+  }
+
 }}
 
 #endif
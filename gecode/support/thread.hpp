@@ -336,6 +336,17 @@ namespace Gecode { namespace Support {
     static void sleep(unsigned int ms);
     /// Return number of processing units (1 if information not available)
     static unsigned int npu(void);
+    /**
+     * \brief Bind current thread to processing unit \a pu
+     *
+     * Processing units are numbered modulo the processing units
+     * available to the process. Returns whether the thread could be bound.
+     */
+    GECODE_SUPPORT_EXPORT static bool bind(unsigned int pu);
+    /// Allow current thread to run on all processing units again
+    GECODE_SUPPORT_EXPORT static void unbind(void);
+    /// Return NUMA node of processing unit \a pu (0 if information not available)
+    GECODE_SUPPORT_EXPORT static unsigned int node(unsigned int pu);
   private:
     /// A thread cannot be copied
     Thread(const Thread&) {}
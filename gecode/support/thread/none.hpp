@@ -76,6 +76,16 @@ namespace Gecode { namespace Support {
   Thread::npu(void) {
     return 1;
   }
+  forceinline bool
+  Thread::bind(unsigned int) {
+    return false;
+  }
+  forceinline void
+  Thread::unbind(void) {}
+  forceinline unsigned int
+  Thread::node(unsigned int) {
+    return 0;
+  }
 
 
 }}
@@ -35,8 +35,80 @@
 
 #ifdef GECODE_THREADS_PTHREADS
 
+#include <sched.h>
+#include <cstdio>
+
 namespace Gecode { namespace Support {
 
+#ifdef CPU_SET
+  /// Return the \a pu-th processor available to the process (-1 if none)
+  static int
+  cpu(unsigned int pu) {
+    cpu_set_t cs;
+    CPU_ZERO(&cs);
+    if (sched_getaffinity(getpid(),sizeof(cpu_set_t),&cs) != 0)
+      return -1;
+    int n = CPU_COUNT(&cs);
+    if (n <= 0)
+      return -1;
+    int i = static_cast<int>(pu % static_cast<unsigned int>(n));
+    for (int c=0; c<CPU_SETSIZE; c++)
+      if (CPU_ISSET(c,&cs) && (i-- == 0))
+        return c;
+    return -1;
+  }
+#endif
+
+  bool
+  Thread::bind(unsigned int pu) {
+#ifdef CPU_SET
+    int c = cpu(pu);
+    if (c < 0)
+      return false;
+    cpu_set_t cs;
+    CPU_ZERO(&cs);
+    CPU_SET(c,&cs);
+    return pthread_setaffinity_np(pthread_self(),sizeof(cpu_set_t),&cs) == 0;
+#else
+    (void) pu;
+    return false;
+#endif
+  }
+
+  void
+  Thread::unbind(void) {
+#ifdef CPU_SET
+    // The process mask is the mask of the main thread
+    cpu_set_t cs;
+    CPU_ZERO(&cs);
+    if (sched_getaffinity(getpid(),sizeof(cpu_set_t),&cs) == 0)
+      (void) pthread_setaffinity_np(pthread_self(),sizeof(cpu_set_t),&cs);
+#endif
+  }
+
+  unsigned int
+  Thread::node(unsigned int pu) {
+#ifdef CPU_SET
+    int c = cpu(pu);
+    if (c < 0)
+      return 0;
+    // Search the node directory that lists the processor
+    for (unsigned int n=0; true; n++) {
+      char d[64];
+      (void) snprintf(d, sizeof(d), "/sys/devices/system/node/node%u", n);
+      if (access(d,F_OK) != 0)
+        return 0;
+      char f[96];
+      (void) snprintf(f, sizeof(f), "%s/cpu%d", d, c);
+      if (access(f,F_OK) == 0)
+        return n;
+    }
+#else
+    (void) pu;
+#endif
+    return 0;
+  }
+
   /// Function to start execution
   void*
   bootstrap(void* p) {
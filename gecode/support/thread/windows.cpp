@@ -35,6 +35,8 @@
 
 #ifdef GECODE_THREADS_WINDOWS
 
+#include <algorithm>
+
 namespace Gecode { namespace Support {
 
   /// Function to start execution
@@ -57,6 +59,26 @@ namespace Gecode { namespace Support {
       throw OperatingSystemError("Thread::run[Windows::CloseHandle]");
   }
 
+  bool
+  Thread::bind(unsigned int pu) {
+    DWORD_PTR m = static_cast<DWORD_PTR>(1) <<
+      (pu % std::min(npu(),
+                     static_cast<unsigned int>(8*sizeof(DWORD_PTR))));
+    return SetThreadAffinityMask(GetCurrentThread(), m) != 0;
+  }
+
+  void
+  Thread::unbind(void) {
+    DWORD_PTR p_m, s_m;
+    if (GetProcessAffinityMask(GetCurrentProcess(), &p_m, &s_m) != 0)
+      (void) SetThreadAffinityMask(GetCurrentThread(), p_m);
+  }
+
+  unsigned int
+  Thread::node(unsigned int) {
+    return 0;
+  }
+
 }}
 
 #endif
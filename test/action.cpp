@@ -0,0 +1,117 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Copyright:
+ *     Gecode contributors, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/kernel.hh>
+#include <gecode/int.hh>
+#include <gecode/search.hh>
+
+#include "test/test.hh"
+
+namespace Test {
+
+  /// %Test for action and CHB information shared by parallel search
+  class ActionCHB : public Test::Base {
+  protected:
+    /// Test space: n-queens with branching based on action or CHB
+    class TestSpace : public Gecode::Space {
+    protected:
+      /// Queen positions
+      Gecode::IntVarArray q;
+    public:
+      /// Constructor for creation
+      TestSpace(int n, bool chb) : q(*this,n,0,n-1) {
+        using namespace Gecode;
+        IntArgs c(n), d(n);
+        for (int i=0; i<n; i++) {
+          c[i]=i; d[i]=-i;
+        }
+        distinct(*this, q);
+        distinct(*this, c, q);
+        distinct(*this, d, q);
+        if (chb)
+          branch(*this, q, INT_VAR_CHB_SIZE_MAX(), INT_VAL_MIN());
+        else
+          branch(*this, q, INT_VAR_ACTION_SIZE_MAX(0.99), INT_VAL_MIN());
+      }
+      /// Constructor for cloning \a s
+      TestSpace(TestSpace& s) : Space(s) {
+        q.update(*this,s.q);
+      }
+      /// Copy during cloning
+      virtual Space* copy(void) {
+        return new TestSpace(*this);
+      }
+    };
+    /// Whether to use CHB (otherwise action)
+    bool chb;
+    /// Number of threads
+    unsigned int t;
+    /// Number of queens
+    static const int n = 8;
+    /// Number of solutions for \a n queens
+    static const int n_sol = 92;
+  public:
+    /// Initialize test for \a t0 threads
+    ActionCHB(bool chb0, unsigned int t0)
+      : Test::Base(std::string(chb0 ? "CHB" : "Action")+
+                   "::Threads::"+str(t0)), chb(chb0), t(t0) {}
+    /// Map unsigned integer to string
+    static std::string str(unsigned int i) {
+      std::stringstream s;
+      s << i;
+      return s.str();
+    }
+    /// Perform actual tests
+    bool run(void) {
+      Gecode::Search::Options o;
+      o.threads = t;
+      o.c_d = 1;
+      Gecode::DFS<TestSpace> e(new TestSpace(n,chb),o);
+      int s = 0;
+      while (TestSpace* sol = e.next()) {
+        delete sol; s++;
+      }
+      // Concurrent updates must neither lose nor duplicate solutions
+      return s == n_sol;
+    }
+  };
+
+  ActionCHB action_threads_1(false,1);
+  ActionCHB action_threads_2(false,2);
+  ActionCHB action_threads_4(false,4);
+  ActionCHB action_threads_8(false,8);
+  ActionCHB chb_threads_1(true,1);
+  ActionCHB chb_threads_2(true,2);
+  ActionCHB chb_threads_4(true,4);
+  ActionCHB chb_threads_8(true,8);
+
+}
+
+// STATISTICS: test-core
@@ -134,6 +134,97 @@ namespace Test {
 
   AFC afc;
 
+#ifdef GECODE_HAS_THREADS
+
+  /// %Test for concurrent failure recording by several threads
+  class AFCThreads : public Test::Base {
+  protected:
+    /// Test space
+    class TestSpace : public Gecode::Space {
+    public:
+      /// Two integer variables
+      Gecode::IntVar x, y;
+      /// Constructor for creation
+      TestSpace(void) : x(*this,0,10), y(*this,0,10) {
+        Gecode::rel(*this, x, Gecode::IRT_LE, y);
+      }
+      /// Constructor for cloning \a s
+      TestSpace(TestSpace& s) : Space(s) {
+        x.update(*this,s.x);
+        y.update(*this,s.y);
+      }
+      /// Copy during cloning
+      virtual Space* copy(void) {
+        return new TestSpace(*this);
+      }
+    };
+    /// Runnable object that fails clones of a space
+    class Failer : public Gecode::Support::Runnable {
+    public:
+      /// The space to clone from
+      TestSpace* s;
+      /// Number of failures to perform
+      int n;
+      /// Event to signal termination
+      Gecode::Support::Event e;
+      /// Initialize
+      Failer(TestSpace* s0, int n0)
+        : Gecode::Support::Runnable(false), s(s0), n(n0) {}
+      /// Perform failures
+      virtual void run(void) {
+        for (int i=n; i--; ) {
+          TestSpace* c = static_cast<TestSpace*>(s->clone());
+          Gecode::rel(*c, c->x, Gecode::IRT_EQ, 10);
+          (void) c->status();
+          delete c;
+        }
+        e.signal();
+      }
+    };
+    /// Number of threads
+    unsigned int t;
+    /// Number of failures per thread
+    static const int n_fail = 1024;
+  public:
+    /// Initialize test for \a t0 threads
+    AFCThreads(unsigned int t0)
+      : Test::Base("AFC::Threads::"+str(t0)), t(t0) {}
+    /// Map unsigned integer to string
+    static std::string str(unsigned int i) {
+      std::stringstream s;
+      s << i;
+      return s.str();
+    }
+    /// Perform actual tests
+    bool run(void) {
+      TestSpace* s = new TestSpace;
+      (void) s->status();
+      Failer** f = new Failer*[t];
+      // Each thread gets its own space, but they all share the afc
+      for (unsigned int i=0; i<t; i++)
+        f[i] = new Failer(static_cast<TestSpace*>(s->clone()),n_fail);
+      for (unsigned int i=0; i<t; i++)
+        Gecode::Support::Thread::run(f[i]);
+      for (unsigned int i=0; i<t; i++) {
+        f[i]->e.wait();
+        delete f[i]->s;
+        delete f[i];
+      }
+      delete [] f;
+      // No failure must be lost
+      bool ok = (s->x.afc() == 1.0 + static_cast<double>(t * n_fail));
+      delete s;
+      return ok;
+    }
+  };
+
+  AFCThreads afc_threads_1(1);
+  AFCThreads afc_threads_2(2);
+  AFCThreads afc_threads_4(4);
+  AFCThreads afc_threads_8(8);
+
+#endif
+
 }
 
 // STATISTICS: test-core
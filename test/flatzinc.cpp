@@ -42,6 +42,12 @@ namespace Test { namespace FlatZinc {
 
   bool
   FlatZincTest::run(void) {
+    // Presolving must not change the output
+    return run(false) && run(true);
+  }
+
+  bool
+  FlatZincTest::run(bool presolve) {
     using namespace Gecode;
     Support::Timer t_total;
     t_total.start();
@@ -49,9 +55,12 @@ namespace Test { namespace FlatZinc {
     fznopt.allSolutions(_allSolutions);
     Gecode::FlatZinc::Printer p;
     Gecode::FlatZinc::FlatZincSpace* fg = NULL;
+    Gecode::Rnd rnd(0U);
     try {
       std::stringstream ss(_source);
-      fg = Gecode::FlatZinc::parse(ss, p, olog);
+      fg = new Gecode::FlatZinc::FlatZincSpace(rnd);
+      fg->presolve(presolve);
+      fg = Gecode::FlatZinc::parse(ss, p, olog, fg, rnd);
 
       if (fg) {
         fg->createBranchers(p, fg->solveAnnotations(), fznopt,
@@ -64,7 +73,9 @@ namespace Test { namespace FlatZinc {
           return true;
         } else {
           if (opt.log)
-            olog << "FlatZinc produced the following output:\n" << os.str() << "\n";
+            olog << "FlatZinc " << (presolve ? "with" : "without")
+                 << " presolving produced the following output:\n"
+                 << os.str() << "\n";
           return false;
         }
       } else {
@@ -58,6 +58,8 @@ namespace Test {
       /// Construct and register test
       FlatZincTest(const std::string& name, const std::string& source,
                    const std::string& expected, bool allSolutions = false);
+      /// Perform test with or without presolving
+      bool run(bool presolve);
       /// Perform test
       virtual bool run(void);
     };
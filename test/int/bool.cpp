@@ -437,6 +437,49 @@ namespace Test { namespace Int {
        }
      };
 
+     /// %Test for clause database
+     class ClauseDB : public Test {
+     protected:
+       /// The clauses in DIMACS notation
+       Gecode::IntArgs c;
+       /// Whether the first and last variable are the same
+       bool shared;
+     public:
+       /// Construct and register test
+       ClauseDB(const std::string& s, int n, const Gecode::IntArgs& c0,
+                bool sh=false)
+         : Test("Bool::ClauseDB::"+s,n,0,1), c(c0), shared(sh) {}
+       /// Return value of DIMACS literal \a l
+       int lit(const Assignment& x, int l) const {
+         int v = (shared && (std::abs(l) == x.size()+1)) ? 0 : std::abs(l)-1;
+         return (l > 0) ? x[v] : 1-x[v];
+       }
+       /// Check whether \a x is solution
+       virtual bool solution(const Assignment& x) const {
+         bool sat = false;
+         for (int i=0; i<c.size(); i++)
+           if (c[i] == 0) {
+             if (!sat)
+               return false;
+             sat = false;
+           } else if (lit(x,c[i]) == 1) {
+             sat = true;
+           }
+         // The last clause need not be terminated
+         return sat || (c.size() == 0) || (c[c.size()-1] == 0);
+       }
+       /// Post constraint
+       virtual void post(Gecode::Space& home, Gecode::IntVarArray& x) {
+         using namespace Gecode;
+         BoolVarArgs b(x.size() + (shared ? 1 : 0));
+         for (int i=x.size(); i--; )
+           b[i]=channel(home,x[i]);
+         if (shared)
+           b[x.size()]=b[0];
+         clause_db(home, b, c);
+       }
+     };
+
      /// %Test for if-then-else-constraint
      class ITEInt : public Test {
      public:
@@ -533,6 +576,18 @@ namespace Test { namespace Int {
      };
 
      Create c;
+     ClauseDB cdb_a("A",4,{1,2,0, -1,3,0, -2,-3,4,0, -4,1,0});
+     ClauseDB cdb_b("B",4,{1,-1,2,0, 3,0, 2,2,-4,0, -3,1,4,0, -2,-4,0});
+     ClauseDB cdb_c("C",3,{1,2,0, -1,-2,0, 2,3,0, -2,-3,0, 1,-3,0});
+     ClauseDB cdb_d("D",5,{1,2,3,0, -1,-2,0, -1,-3,0, -2,-3,0,
+                           4,5,-1,0, -4,-5,0, 2,-4,0, 3,-5,0, -3,5,4});
+     ClauseDB cdb_e("E",3,{1,-4,0, -1,2,0, -2,4,3,0, 4,-3,0},true);
+     ClauseDB cdb_f("F",2,{1,0, -1,2,0, -2,0});
+     ClauseDB cdb_g("G",3,{1,2,3,0, 0});
+     ClauseDB cdb_h("H",8,{-6,2,-4,0, -6,5,1,0, 7,1,-2,0, -2,-8,-6,0,
+                           7,-1,2,0, -3,-5,-1,0, -2,5,-7,0, -2,5,-1,0,
+                           -6,4,5,0, 3,6,2,0, 6,-8,4,0, 7,2,3,0,
+                           -2,-7,5,0, -6,5,-4,0});
      ITEInt itebnd(Gecode::IPL_BND);
      ITEInt itedom(Gecode::IPL_DOM);
      ITEBool itebool;
@@ -264,6 +264,117 @@ namespace Test {
     };
 
 
+    /// Example for testing sharing no-goods between assets of a portfolio
+    class ShareQueens : public Space {
+    public:
+      /// Number of queens
+      const static int n = 18;
+      /// Position of queens on boards
+      IntVarArray q;
+      /// Number of queens branched on by all assets
+      int c;
+      /// The actual problem
+      ShareQueens(int c0)
+        : q(*this,n,0,n-1), c(c0) {
+        distinct(*this, IntArgs::create(n,0,1), q, IPL_VAL);
+        distinct(*this, IntArgs::create(n,0,-1), q, IPL_VAL);
+        distinct(*this, q, IPL_VAL);
+        IntVarArgs x(c);
+        for (int i=0; i<c; i++)
+          x[i] = q[i];
+        branch(*this, x, INT_VAR_NONE(), INT_VAL_MIN());
+      }
+      /// Constructor for cloning \a s
+      ShareQueens(ShareQueens& s) : Space(s), c(s.c) {
+        q.update(*this, s.q);
+      }
+      /// Perform copying during cloning
+      virtual Space* copy(void) {
+        return new ShareQueens(*this);
+      }
+      /// Keep branchers for all assets
+      virtual bool master(const MetaInfo& mi) {
+        if (mi.type() == MetaInfo::PORTFOLIO)
+          return true;
+        return Space::master(mi);
+      }
+      /// Branch differently for each asset
+      virtual bool slave(const MetaInfo& mi) {
+        if (mi.type() == MetaInfo::PORTFOLIO) {
+          IntVarArgs x(n-c);
+          for (int i=c; i<n; i++)
+            x[i-c] = q[i];
+          if ((mi.asset() & 1U) != 0U)
+            branch(*this, x, INT_VAR_NONE(), INT_VAL_SPLIT_MIN());
+          else
+            branch(*this, x, INT_VAR_SIZE_MIN(), INT_VALUES_MAX());
+        }
+        return true;
+      }
+      /// Check whether solution is correct
+      bool correct(void) const {
+        for (int i=0; i<n; i++)
+          for (int j=i+1; j<n; j++)
+            if ((q[i].val() == q[j].val()) ||
+                (q[i].val()+i == q[j].val()+j) ||
+                (q[i].val()-i == q[j].val()-j))
+              return false;
+        return true;
+      }
+    };
+
+    /// %Test for sharing no-goods between assets of a portfolio
+    class Share : public Base {
+    protected:
+      /// Number of queens branched on by all assets
+      int c;
+      /// Number of assets
+      unsigned int a;
+      /// Number of threads to use
+      unsigned int t;
+    public:
+      /// Map unsigned integer to string
+      static std::string str(unsigned int i) {
+        std::stringstream s;
+        s << i;
+        return s.str();
+      }
+      /// Initialize test
+      Share(int c0, unsigned int a0, unsigned int t0)
+        : Base("NoGoods::Share::"+str(c0)+"::"+str(a0)+"::"+str(t0)),
+          c(c0), a(a0), t(t0) {}
+      /// Run test
+      virtual bool run(void) {
+        ShareQueens* m = new ShareQueens(c);
+        Search::Options mo;
+        mo.threads = t;
+        mo.nogoods_share = true;
+        SEBs sebs(a);
+        for (unsigned int i=0U; i<a; i++) {
+          Search::Options so;
+          so.nogoods_limit = 256U;
+          so.cutoff = Search::Cutoff::constant(10U*(i+1U));
+          sebs[i] = rbs<ShareQueens,Gecode::DFS>(so);
+        }
+        PBS<ShareQueens,Gecode::DFS> pbs(m, sebs, mo);
+        delete m;
+        ShareQueens* s = pbs.next();
+        bool ok = (s != NULL) && s->correct();
+        delete s;
+        Search::Statistics st = pbs.statistics();
+        // Shared no-goods are also counted as posted no-goods
+        if (st.nogood < st.nogood_shared)
+          return false;
+        // Without branchers common to all assets nothing can be shared
+        if (c == 0)
+          return ok && (st.nogood_shared == 0UL);
+        // No-goods are shared once every asset has restarted
+        if (st.restart >= 2UL*a)
+          return ok && (st.nogood_shared > 0UL);
+        return ok;
+      }
+    };
+
     /// Help class to create and register tests
     class Create {
     public:
@@ -291,6 +402,10 @@ namespace Test {
           } while (n);
           a = !a;
         } while (a);
+        for (int c=0; c<=ShareQueens::n; c += ShareQueens::n/2)
+          for (unsigned int a=2; a<=4; a += 2)
+            for (unsigned int t=1; t<=4; t *= 2)
+              (void) new Share(c,a,t);
       }
     };
 
@@ -0,0 +1,127 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Copyright:
+ *     Gecode contributors, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/kernel.hh>
+#include <gecode/int.hh>
+#include <gecode/search.hh>
+
+#include "test/test.hh"
+
+namespace Test {
+
+  /// %Test for propagator scheduling
+  class Scheduling : public Test::Base {
+  protected:
+    /// Test space: n-queens
+    class TestSpace : public Gecode::Space {
+    protected:
+      /// Queen positions
+      Gecode::IntVarArray q;
+    public:
+      /// Constructor for creation
+      TestSpace(int n, Gecode::PropagatorScheduling ps)
+        : q(*this,n,0,n-1) {
+        using namespace Gecode;
+        scheduling(ps);
+        // Use propagators of different classes and cost
+        IntArgs c(2);
+        c[0]=1; c[1]=-1;
+        for (int i=0; i<n; i++)
+          for (int j=i+1; j<n; j++) {
+            IntVarArgs x(2);
+            x[0]=q[i]; x[1]=q[j];
+            rel(*this, q[i], IRT_NQ, q[j]);
+            linear(*this, c, x, IRT_NQ, j-i);
+            linear(*this, c, x, IRT_NQ, i-j);
+          }
+        distinct(*this, q, IPL_DOM);
+        branch(*this, q, INT_VAR_AFC_SIZE_MAX(), INT_VAL_MIN());
+      }
+      /// Constructor for cloning \a s
+      TestSpace(TestSpace& s) : Space(s) {
+        q.update(*this,s.q);
+      }
+      /// Copy during cloning
+      virtual Space* copy(void) {
+        return new TestSpace(*this);
+      }
+    };
+    /// The propagator scheduling
+    Gecode::PropagatorScheduling ps;
+    /// Number of queens
+    static const int n = 8;
+    /// Number of solutions for \a n queens
+    static const int n_sol = 92;
+  public:
+    /// Initialize test for scheduling \a ps0
+    Scheduling(Gecode::PropagatorScheduling ps0)
+      : Test::Base(std::string("Scheduling::")+str(ps0)), ps(ps0) {}
+    /// Map scheduling to string
+    static std::string str(Gecode::PropagatorScheduling ps) {
+      switch (ps) {
+      case Gecode::PS_FIFO:  return "Fifo";
+      case Gecode::PS_CLASS: return "Class";
+      case Gecode::PS_AFC:   return "AFC";
+      default: GECODE_NEVER;
+      }
+      return "";
+    }
+    /// Perform actual tests
+    bool run(void) {
+      TestSpace* s = new TestSpace(n,ps);
+      if (s->scheduling() != ps) {
+        delete s; return false;
+      }
+      Gecode::DFS<TestSpace> e(s);
+      int m = 0;
+      while (TestSpace* sol = e.next()) {
+        // Scheduling must be inherited by clones
+        if (sol->scheduling() != ps) {
+          delete sol; return false;
+        }
+        delete sol; m++;
+      }
+      if (m != n_sol)
+        return false;
+      Gecode::Search::Statistics st = e.statistics();
+      unsigned long int p = 0;
+      for (int i=0; i<=Gecode::PropCost::AC_MAX; i++)
+        p += st.propagate_cost[i];
+      return (p == st.propagate) && (st.idle <= st.propagate);
+    }
+  };
+
+  Scheduling scheduling_fifo(Gecode::PS_FIFO);
+  Scheduling scheduling_class(Gecode::PS_CLASS);
+  Scheduling scheduling_afc(Gecode::PS_AFC);
+
+}
+
+// STATISTICS: test-core
@@ -308,6 +308,31 @@ namespace Test {
       }
     };
 
+    /// Space with a large search tree that needs no propagation
+    class LargeTree : public Space {
+    public:
+      /// Variables used
+      IntVarArray x;
+      /// Constructor for space creation
+      LargeTree(void) : x(*this,8,0,3) {
+        Gecode::branch(*this, x, INT_VAR_NONE(), INT_VAL_MIN());
+      }
+      /// Constructor for cloning \a s
+      LargeTree(LargeTree& s) : Space(s) {
+        x.update(*this, s.x);
+      }
+      /// Copy during cloning
+      virtual Space* copy(void) {
+        return new LargeTree(*this);
+      }
+      /// Add no constraint (all solutions are equally good)
+      virtual void constrain(const Space&) {}
+      /// Return number of solutions
+      static unsigned long int solutions(void) {
+        return 4UL*4UL*4UL*4UL*4UL*4UL*4UL*4UL;
+      }
+    };
+
     /// %Base class for search tests
     class Test : public Base {
     public:
@@ -364,14 +389,22 @@ namespace Test {
       unsigned int a_d;
       /// Number of threads
       unsigned int t;
+      /// Whether to use randomized work stealing
+      bool ws;
+      /// Whether to bind workers to processing units
+      bool af;
+      /// Whether to adapt the commit distance
+      bool ad;
     public:
       /// Initialize test
       DFS(HowToBranch htb1, HowToBranch htb2, HowToBranch htb3,
-          unsigned int c_d0, unsigned int a_d0, unsigned int t0)
+          unsigned int c_d0, unsigned int a_d0, unsigned int t0,
+          bool ws0=false, bool af0=false, bool ad0=false)
         : Test("DFS::"+Model::name()+"::"+
                str(htb1)+"::"+str(htb2)+"::"+str(htb3)+"::"+
-               str(c_d0)+"::"+str(a_d0)+"::"+str(t0),
-               htb1,htb2,htb3), c_d(c_d0), a_d(a_d0), t(t0) {}
+               str(c_d0)+"::"+str(a_d0)+"::"+str(t0)+(ws0 ? "::WS" : "")+(af0 ? "::Affinity" : "")+
+               (ad0 ? "::Adaptive" : ""),
+               htb1,htb2,htb3), c_d(c_d0), a_d(a_d0), t(t0), ws(ws0), af(af0), ad(ad0) {}
       /// Run test
       virtual bool run(void) {
         Model* m = new Model(htb1,htb2,htb3);
@@ -380,6 +413,9 @@ namespace Test {
         o.c_d = c_d;
         o.a_d = a_d;
         o.threads = t;
+        o.ws = ws;
+        o.affinity = af;
+        o.c_d_adaptive = ad;
         o.stop = &f;
         Gecode::DFS<Model> dfs(m,o);
         int n = m->solutions();
@@ -444,15 +480,23 @@ namespace Test {
       unsigned int a_d;
       /// Number of threads
       unsigned int t;
+      /// Whether to use randomized work stealing
+      bool ws;
+      /// Whether to bind workers to processing units
+      bool af;
+      /// Whether to adapt the commit distance
+      bool ad;
     public:
       /// Initialize test
       BAB(HowToConstrain htc,
           HowToBranch htb1, HowToBranch htb2, HowToBranch htb3,
-          unsigned int c_d0, unsigned int a_d0, unsigned int t0)
+          unsigned int c_d0, unsigned int a_d0, unsigned int t0,
+          bool ws0=false, bool af0=false, bool ad0=false)
         : Test("BAB::"+Model::name()+"::"+str(htc)+"::"+
                str(htb1)+"::"+str(htb2)+"::"+str(htb3)+"::"+
-               str(c_d0)+"::"+str(a_d0)+"::"+str(t0),
-               htb1,htb2,htb3,htc), c_d(c_d0), a_d(a_d0), t(t0) {}
+               str(c_d0)+"::"+str(a_d0)+"::"+str(t0)+(ws0 ? "::WS" : "")+(af0 ? "::Affinity" : "")+
+               (ad0 ? "::Adaptive" : ""),
+               htb1,htb2,htb3,htc), c_d(c_d0), a_d(a_d0), t(t0), ws(ws0), af(af0), ad(ad0) {}
       /// Run test
       virtual bool run(void) {
         Model* m = new Model(htb1,htb2,htb3,htc);
@@ -461,6 +505,9 @@ namespace Test {
         o.c_d = c_d;
         o.a_d = a_d;
         o.threads = t;
+        o.ws = ws;
+        o.affinity = af;
+        o.c_d_adaptive = ad;
         o.stop = &f;
         Gecode::BAB<Model> bab(m,o);
         delete m;
@@ -647,6 +694,37 @@ namespace Test {
       }
     };
 
+    /// %Test that idle workers of parallel engines steal work
+    template<template<class> class Engine>
+    class Steal : public Base {
+    private:
+      /// Number of threads
+      unsigned int t;
+      /// Whether to use randomized work stealing
+      bool ws;
+    public:
+      /// Initialize test
+      Steal(const std::string& e, unsigned int t0, bool ws0)
+        : Base("Search::Steal::"+e+"::"+Test::str(t0)+(ws0 ? "::WS" : "")),
+          t(t0), ws(ws0) {}
+      /// Run test
+      virtual bool run(void) {
+        LargeTree* m = new LargeTree;
+        Gecode::Search::Options o;
+        o.threads = t;
+        o.ws = ws;
+        Engine<LargeTree> e(m,o);
+        delete m;
+        unsigned long int n = 0;
+        while (LargeTree* s = e.next()) {
+          n++; delete s;
+        }
+        // Only the first worker starts with work, all others must steal
+        return (n == LargeTree::solutions()) &&
+          (e.statistics().steal_success > 0UL);
+      }
+    };
+
     /// Iterator for branching types
     class BranchTypes {
     private:
@@ -753,6 +831,62 @@ namespace Test {
               (void) new BAB<HasSolutions>
                 (HTC_NONE,HTB_NONE,HTB_NONE,HTB_NONE,c_d,a_d,t);
             }
+        // Randomized work stealing
+        for (unsigned int t = 2; t<=4; t++) {
+          for (BranchTypes htb1; htb1(); ++htb1)
+            for (BranchTypes htb2; htb2(); ++htb2)
+              for (BranchTypes htb3; htb3(); ++htb3) {
+                (void) new DFS<HasSolutions>
+                  (htb1.htb(),htb2.htb(),htb3.htb(),
+                   Gecode::Search::Config::c_d,Gecode::Search::Config::a_d,
+                   t,true);
+                for (ConstrainTypes htc; htc(); ++htc)
+                  (void) new BAB<HasSolutions>
+                    (htc.htc(),htb1.htb(),htb2.htb(),htb3.htb(),
+                     Gecode::Search::Config::c_d,Gecode::Search::Config::a_d,
+                     t,true);
+              }
+          (void) new DFS<FailImmediate>(HTB_NONE, HTB_NONE, HTB_NONE,
+                                        Gecode::Search::Config::c_d,
+                                        Gecode::Search::Config::a_d,
+                                        t, true);
+          (void) new BAB<FailImmediate>
+            (HTC_NONE,HTB_NONE,HTB_NONE,HTB_NONE,
+             Gecode::Search::Config::c_d,Gecode::Search::Config::a_d,
+             t,true);
+        }
+#ifdef GECODE_HAS_THREADS
+        // Idle workers steal work
+        for (unsigned int t = 2; t<=4; t++)
+          for (int ws = 0; ws < 2; ws++) {
+            (void) new Steal<Gecode::DFS>("DFS",t,ws == 1);
+            (void) new Steal<Gecode::BAB>("BAB",t,ws == 1);
+          }
+#endif
+        // Workers bound to processing units
+        for (unsigned int t = 2; t<=4; t++)
+          for (int ws = 0; ws < 2; ws++) {
+            (void) new DFS<HasSolutions>
+              (HTB_BINARY,HTB_NARY,HTB_UNARY,
+               Gecode::Search::Config::c_d,Gecode::Search::Config::a_d,
+               t,ws == 1,true);
+            (void) new BAB<HasSolutions>
+              (HTC_BAL_GR,HTB_BINARY,HTB_NARY,HTB_UNARY,
+               Gecode::Search::Config::c_d,Gecode::Search::Config::a_d,
+               t,ws == 1,true);
+          }
+        // Adaptive commit distance
+        for (unsigned int t = 1; t<=4; t++)
+          for (BranchTypes htb1; htb1(); ++htb1)
+            for (BranchTypes htb2; htb2(); ++htb2)
+              for (BranchTypes htb3; htb3(); ++htb3) {
+                (void) new DFS<HasSolutions>
+                  (htb1.htb(),htb2.htb(),htb3.htb(),
+                   2,1,t,false,false,true);
+                (void) new BAB<HasSolutions>
+                  (HTC_BAL_GR,htb1.htb(),htb2.htb(),htb3.htb(),
+                   2,1,t,false,false,true);
+              }
         // Restart-based search
         for (unsigned int t=1; t<=4; t++) {
           (void) new RBS<HasSolutions,Gecode::DFS>("DFS",t);
@@ -58,10 +58,12 @@ int main(int argc, char** argv) {
   FlatZinc::FlatZincSpace* fg = NULL;
   Rnd rnd(opt.seed());
   try {
+    fg = new FlatZinc::FlatZincSpace(rnd);
+    fg->presolve(opt.presolve());
     if (!strcmp(filename, "-")) {
-      fg = FlatZinc::parse(cin, p, std::cerr, NULL, rnd);
+      fg = FlatZinc::parse(cin, p, std::cerr, fg, rnd);
     } else {
-      fg = FlatZinc::parse(filename, p, std::cerr, NULL, rnd);
+      fg = FlatZinc::parse(filename, p, std::cerr, fg, rnd);
     }
 
     if (fg) {